@@ -0,0 +1,602 @@
+//! A simple Brainfuck interpreter - benchmark harness.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//! Runs every benchmark program against every engine of bin/bf and reports wall
+//  time, executed operations per second and peak RSS as JSON. Outputs are checked
+//  against bench/expected, which --update regenerates with a naive reference
+//  interpreter that also counts the operations a program executes.
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+namespace {
+
+//! A program to run, either one of the examples or a generated stress program.
+struct benchmark_t {
+        std::string name;
+        std::string path;
+        std::string input;           // file fed to stdin, /dev/null if empty
+        int eof;                     // value ',' stores at the end of input
+        std::vector<std::string> arguments;
+};
+
+//! What the program is supposed to print, and how many operations that takes.
+struct expected_t {
+        uint64_t operations;
+        uint64_t length;
+        uint64_t hash;
+};
+
+//! One engine running one program, the best of a number of runs.
+struct result_t {
+        std::string benchmark;
+        std::string engine;
+        unsigned int runs;
+        double best_seconds;
+        double mean_seconds;
+        long peak_rss_kb;
+        int status;
+        bool correct;
+        uint64_t operations;
+};
+
+const char* const engines[] = { "tiered", "threaded", "switch", "jit" };
+
+uint64_t fnv1a(uint64_t hash, const char* data, std::size_t size)
+{
+        for (std::size_t i = 0; i != size; ++i) {
+                hash ^= static_cast<unsigned char>(data[i]);
+                hash *= 1099511628211ull;
+        }
+
+        return hash;
+}
+
+const uint64_t fnv1a_basis = 14695981039346656037ull;
+
+std::string read_file(const std::string& path)
+{
+        std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+
+        if (!file)
+                throw std::runtime_error("can't read " + path);
+
+        std::ostringstream contents;
+        contents<<file.rdbuf();
+
+        return contents.str();
+}
+
+void write_file(const std::string& path, const std::string& contents)
+{
+        std::ofstream file(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+        if (!file.write(contents.data(), contents.size()))
+                throw std::runtime_error("can't write " + path);
+}
+
+//! Stress programs. Each of them leans on one part of the interpreter.
+
+//! Thousands of loops nested inside one another that never run, which is all
+//  parsing, around twelve counters nested four deep that do.
+std::string deep_nesting()
+{
+        std::string program(5000, '[');
+        program.append(5000, ']');
+
+        const int depth = 12;
+
+        for (int i = 0; i != depth; ++i)
+                program += "++++[>";
+        program += "+";
+        for (int i = 0; i != depth; ++i)
+                program += "<-]";
+
+        program.append(depth, '>');
+        program += "[-]++++++++++.";
+        return program;
+}
+
+//! Long runs of '+', '-', '>' and '<' inside two loops. The clear keeps the inner
+//  loop from being turned into multiply-adds.
+std::string long_runs()
+{
+        std::string program(100, '+');
+
+        program += "[>";
+        program.append(100, '+');
+        program += "[>";
+
+        for (int i = 0; i != 64; ++i) {
+                program.append(250, '+');
+                program.append(17, '>');
+                program.append(249, '-');
+                program.append(17, '<');
+                program.append(1, '>');
+        }
+
+        program += "[-]";
+        program.append(64, '<');
+        program += "<-]<-]>>.[-]++++++++++.";
+        return program;
+}
+
+//! [>] and [<] sweeps over thirty thousand nonzero cells, four thousand times.
+std::string scan_heavy()
+{
+        std::string program = ">";
+
+        program.append(200, '+');
+        program += ">";
+        for (int i = 0; i != 30000; ++i)
+                program += "+>";
+
+        program += "<[<]>[";
+        for (int i = 0; i != 20; ++i)
+                program += ">[>]<[<]>";
+        program += "-]++++++++++.";
+        return program;
+}
+
+//! Copies its input to its output a byte at a time.
+std::string io_heavy()
+{
+        return ",[.,]";
+}
+
+//! Eight megabytes of text that io_heavy copies.
+std::string io_heavy_input()
+{
+        std::string input;
+        uint32_t state = 1;
+
+        input.reserve(8 << 20);
+
+        while (input.size() != (8u << 20)) {
+                state = state * 1103515245 + 12345;
+                char c = static_cast<char>('a' + (state >> 16) % 26);
+                input += (state >> 8) % 16 == 0 ? '\n' : c;
+        }
+
+        return input;
+}
+
+//! Writes the stress programs next to the results and lists every benchmark.
+std::vector<benchmark_t> benchmarks(const std::string& work)
+{
+        std::vector<benchmark_t> all;
+
+        const char* const examples[] = { "mandelbrot", "hanoi", "squares" };
+
+        for (std::size_t i = 0; i != sizeof examples / sizeof *examples; ++i) {
+                benchmark_t benchmark;
+
+                benchmark.name = examples[i];
+                benchmark.path = std::string("examples/") + examples[i] + ".bf";
+                benchmark.eof = -1;
+                benchmark.arguments.push_back("-i");
+                all.push_back(benchmark);
+        }
+
+        struct {
+                const char* name;
+                std::string (*program)();
+        } stress[] = {
+                { "deep_nesting", &deep_nesting }
+              , { "long_runs",    &long_runs }
+              , { "scan_heavy",   &scan_heavy }
+              , { "io_heavy",     &io_heavy }
+        };
+
+        for (std::size_t i = 0; i != sizeof stress / sizeof *stress; ++i) {
+                benchmark_t benchmark;
+
+                benchmark.name = stress[i].name;
+                benchmark.path = work + "/" + stress[i].name + ".bf";
+                benchmark.eof = -1;
+                write_file(benchmark.path, stress[i].program());
+
+                if (benchmark.name == "io_heavy") {
+                        benchmark.input = work + "/io_heavy.in";
+                        benchmark.eof = 0;
+                        benchmark.arguments.push_back("--eof=0");
+                        write_file(benchmark.input, io_heavy_input());
+                }
+
+                all.push_back(benchmark);
+        }
+
+        return all;
+}
+
+//! Reference interpreter - as plain as it gets, one command at a time on 8 bit
+//  wrapping cells. Returns the output and counts every command executed.
+std::string reference(const std::string& program, const std::string& input, int eof, uint64_t& operations)
+{
+        std::vector<std::size_t> partner(program.size());
+        std::vector<std::size_t> open;
+
+        for (std::size_t i = 0; i != program.size(); ++i) {
+                if (program[i] == '[') {
+                        open.push_back(i);
+                }
+                else if (program[i] == ']') {
+                        if (open.empty())
+                                throw std::runtime_error("unbalanced program");
+                        partner[i] = open.back();
+                        partner[open.back()] = i;
+                        open.pop_back();
+                }
+        }
+
+        if (!open.empty())
+                throw std::runtime_error("unbalanced program");
+
+        std::vector<unsigned char> tape(65536);
+        std::size_t pc = 0;
+        std::size_t consumed = 0;
+        std::string output;
+
+        operations = 0;
+
+        for (std::size_t ip = 0; ip != program.size(); ++ip) {
+                switch (program[ip]) {
+                case '+': ++tape[pc]; break;
+                case '-': --tape[pc]; break;
+                case '>':
+                        if (++pc == tape.size())
+                                tape.resize(tape.size() * 2);
+                        break;
+                case '<':
+                        if (pc-- == 0)
+                                throw std::runtime_error("pc underflow");
+                        break;
+                case '.': output += static_cast<char>(tape[pc]); break;
+                case ',':
+                        if (consumed != input.size())
+                                tape[pc] = input[consumed++];
+                        else
+                                tape[pc] = static_cast<unsigned char>(eof);
+                        break;
+                case '[':
+                        if (!tape[pc])
+                                ip = partner[ip];
+                        break;
+                case ']':
+                        if (tape[pc])
+                                ip = partner[ip];
+                        break;
+                default:
+                        continue;
+                }
+
+                ++operations;
+        }
+
+        return output;
+}
+
+std::map<std::string, expected_t> read_expected(const std::string& path)
+{
+        std::map<std::string, expected_t> all;
+        std::istringstream lines(read_file(path));
+        std::string line;
+
+        while (std::getline(lines, line)) {
+                if (line.empty() || line[0] == '#')
+                        continue;
+
+                std::istringstream fields(line);
+                std::string name;
+                expected_t expected;
+
+                if (fields>>name>>expected.operations>>expected.length>>std::hex>>expected.hash)
+                        all[name] = expected;
+        }
+
+        return all;
+}
+
+void update_expected(const std::string& path, const std::vector<benchmark_t>& all)
+{
+        std::ostringstream out;
+
+        out<<"# name operations output-length output-fnv1a, regenerate with bench --update\n";
+
+        for (std::size_t i = 0; i != all.size(); ++i) {
+                std::string input = all[i].input.empty() ? std::string() : read_file(all[i].input);
+                uint64_t operations;
+                std::string output = reference(read_file(all[i].path), input, all[i].eof, operations);
+
+                out<<all[i].name<<' '<<operations<<' '<<output.size()<<' '
+                   <<std::hex<<fnv1a(fnv1a_basis, output.data(), output.size())<<std::dec<<'\n';
+
+                std::cerr<<all[i].name<<": "<<operations<<" operations"<<std::endl;
+        }
+
+        write_file(path, out.str());
+}
+
+double now()
+{
+        struct timespec time;
+
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+//! Runs bf once. Output is hashed as it arrives so it never has to fit in memory.
+void run_once(const std::string& bf, const std::string& engine, const benchmark_t& benchmark,
+              double& seconds, long& peak_rss_kb, int& status, uint64_t& length, uint64_t& hash)
+{
+        std::vector<std::string> arguments;
+
+        arguments.push_back(bf);
+        arguments.push_back("--engine=" + engine);
+        arguments.insert(arguments.end(), benchmark.arguments.begin(), benchmark.arguments.end());
+        arguments.push_back(benchmark.path);
+
+        std::vector<char*> argv;
+
+        for (std::size_t i = 0; i != arguments.size(); ++i)
+                argv.push_back(const_cast<char*>(arguments[i].c_str()));
+        argv.push_back(0);
+
+        int output[2];
+
+        if (pipe(output) != 0)
+                throw std::runtime_error("can't create a pipe");
+
+        double start = now();
+        pid_t child = fork();
+
+        if (child < 0)
+                throw std::runtime_error("can't fork");
+
+        if (child == 0) {
+                int input = open(benchmark.input.empty() ? "/dev/null" : benchmark.input.c_str(), O_RDONLY);
+
+                dup2(input, STDIN_FILENO);
+                dup2(output[1], STDOUT_FILENO);
+                close(output[0]);
+                close(output[1]);
+                execv(argv[0], &argv[0]);
+                _exit(127);
+        }
+
+        close(output[1]);
+
+        char buffer[1 << 16];
+        ssize_t got;
+
+        length = 0;
+        hash = fnv1a_basis;
+
+        while ((got = read(output[0], buffer, sizeof buffer)) != 0) {
+                if (got < 0)
+                        continue;
+
+                length += got;
+                hash = fnv1a(hash, buffer, got);
+        }
+
+        close(output[0]);
+
+        struct rusage usage;
+        int wait_status;
+
+        wait4(child, &wait_status, 0, &usage);
+
+        seconds = now() - start;
+        peak_rss_kb = usage.ru_maxrss;
+        status = WIFEXITED(wait_status) ? WEXITSTATUS(wait_status) : 128 + WTERMSIG(wait_status);
+}
+
+result_t run(const std::string& bf, const std::string& engine, const benchmark_t& benchmark, const expected_t* expected, unsigned int runs)
+{
+        result_t result;
+
+        result.benchmark = benchmark.name;
+        result.engine = engine;
+        result.runs = runs;
+        result.best_seconds = 0;
+        result.mean_seconds = 0;
+        result.peak_rss_kb = 0;
+        result.status = 0;
+        result.correct = true;
+        result.operations = expected ? expected->operations : 0;
+
+        for (unsigned int i = 0; i != runs; ++i) {
+                double seconds;
+                long peak_rss_kb;
+                int status;
+                uint64_t length, hash;
+
+                run_once(bf, engine, benchmark, seconds, peak_rss_kb, status, length, hash);
+
+                if (i == 0 || seconds < result.best_seconds)
+                        result.best_seconds = seconds;
+                result.mean_seconds += seconds / runs;
+                result.peak_rss_kb = std::max(result.peak_rss_kb, peak_rss_kb);
+
+                if (status != 0)
+                        result.status = status;
+                if (!expected || status != 0 || length != expected->length || hash != expected->hash)
+                        result.correct = false;
+        }
+
+        return result;
+}
+
+std::string json_string(const std::string& value)
+{
+        std::string quoted = "\"";
+
+        for (std::size_t i = 0; i != value.size(); ++i) {
+                if (value[i] == '"' || value[i] == '\\')
+                        quoted += '\\';
+                quoted += value[i];
+        }
+
+        return quoted + "\"";
+}
+
+void write_json(std::ostream& out, const std::string& bf, const std::vector<result_t>& results)
+{
+        out<<"{\n"
+           <<"  \"bf\": "<<json_string(bf)<<",\n"
+           <<"  \"timestamp\": "<<static_cast<long>(time(0))<<",\n"
+           <<"  \"results\": [\n";
+
+        for (std::size_t i = 0; i != results.size(); ++i) {
+                const result_t& result = results[i];
+                double ops_per_second = result.best_seconds > 0 ? result.operations / result.best_seconds : 0;
+
+                out<<"    { \"benchmark\": "<<json_string(result.benchmark)
+                   <<", \"engine\": "<<json_string(result.engine)
+                   <<", \"runs\": "<<result.runs
+                   <<", \"best_seconds\": "<<std::fixed<<std::setprecision(6)<<result.best_seconds
+                   <<", \"mean_seconds\": "<<result.mean_seconds
+                   <<", \"operations\": "<<result.operations
+                   <<", \"ops_per_second\": "<<std::setprecision(0)<<ops_per_second
+                   <<", \"peak_rss_kb\": "<<result.peak_rss_kb
+                   <<", \"status\": "<<result.status
+                   <<", \"correct\": "<<(result.correct ? "true" : "false")
+                   <<" }"<<(i + 1 != results.size() ? "," : "")<<"\n";
+        }
+
+        out<<"  ]\n"
+           <<"}\n";
+}
+
+int usage()
+{
+        using namespace std;
+
+        cout<<"Usage: bench [OPTION]... [benchmark]..."<<endl<<endl;
+        cout<<"Options:"<<endl;
+        cout<<"  -b path     interpreter to measure (default ./bin/bf)"<<endl;
+        cout<<"  -e engine   only this engine, may be repeated"<<endl;
+        cout<<"  -r runs     runs per benchmark and engine (default 3)"<<endl;
+        cout<<"  -o file     write the JSON results to file instead of stdout"<<endl;
+        cout<<"  -w dir      where generated programs go (default bin/stress)"<<endl;
+        cout<<"  -u          regenerate bench/expected with the reference interpreter"<<endl;
+        cout<<"  -h          print this message"<<endl;
+
+        return EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+        std::string bf = "./bin/bf";
+        std::string output;
+        std::string work = "bin/stress";
+        std::string expected_path = "bench/expected";
+        std::vector<std::string> selected_engines;
+        unsigned int runs = 3;
+        bool update = false;
+        int option;
+
+        while ((option = getopt(argc, argv, "b:e:r:o:w:uh")) != -1) {
+                switch (option) {
+                case 'b': bf = optarg; break;
+                case 'e': selected_engines.push_back(optarg); break;
+                case 'r': runs = std::max(1, atoi(optarg)); break;
+                case 'o': output = optarg; break;
+                case 'w': work = optarg; break;
+                case 'u': update = true; break;
+                case 'h': return usage();
+                default:
+                        usage();
+                        return EXIT_FAILURE;
+                }
+        }
+
+        if (selected_engines.empty())
+                selected_engines.assign(engines, engines + sizeof engines / sizeof *engines);
+
+        try {
+                mkdir(work.c_str(), 0777);
+
+                std::vector<benchmark_t> all = benchmarks(work);
+
+                if (update) {
+                        update_expected(expected_path, all);
+                        return EXIT_SUCCESS;
+                }
+
+                std::map<std::string, expected_t> expected = read_expected(expected_path);
+                std::vector<result_t> results;
+                bool all_correct = true;
+
+                for (std::size_t i = 0; i != all.size(); ++i) {
+                        if (optind != argc && std::find(argv + optind, argv + argc, all[i].name) == argv + argc)
+                                continue;
+
+                        std::map<std::string, expected_t>::const_iterator found = expected.find(all[i].name);
+
+                        for (std::size_t j = 0; j != selected_engines.size(); ++j) {
+                                result_t result = run(bf, selected_engines[j], all[i], found != expected.end() ? &found->second : 0, runs);
+
+                                std::cerr<<std::left<<std::setw(14)<<result.benchmark<<std::setw(10)<<result.engine
+                                         <<std::right<<std::fixed<<std::setprecision(3)<<std::setw(9)<<result.best_seconds<<" s "
+                                         <<std::setw(9)<<std::setprecision(1)<<(result.best_seconds > 0 ? result.operations / result.best_seconds / 1e6 : 0)<<" Mops/s "
+                                         <<std::setw(9)<<result.peak_rss_kb<<" KB  "
+                                         <<(result.correct ? "ok" : "WRONG OUTPUT")<<std::endl;
+
+                                all_correct = all_correct && result.correct;
+                                results.push_back(result);
+                        }
+                }
+
+                if (output.empty()) {
+                        write_json(std::cout, bf, results);
+                }
+                else {
+                        std::ofstream file(output.c_str());
+                        write_json(file, bf, results);
+                }
+
+                return all_correct ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        catch (std::runtime_error& e) {
+                std::cerr<<"Error: "<<e.what()<<std::endl;
+                return EXIT_FAILURE;
+        }
+}
\ No newline at end of file
@@ -0,0 +1,6007 @@
+/* Generated by bf. */
+typedef unsigned char cell_t;
+typedef unsigned char ucell_t;
+
+#define LOWEST  -221
+#define HIGHEST 222
+
+#define FLUSH_LINES  0
+#define FLUSH_INPUT  1
+#define END_OF_INPUT -1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static cell_t* tape;
+static size_t  tape_size = 65536 - LOWEST;
+static cell_t* low;
+static cell_t* high;
+
+static unsigned char output[1 << 16];
+static size_t        output_used;
+
+static void flush_output(void)
+{
+        fwrite(output, 1, output_used, stdout);
+        fflush(stdout);
+        output_used = 0;
+}
+
+static void put(cell_t value, unsigned int count)
+{
+        while (count--) {
+                if (output_used == sizeof output)
+                        flush_output();
+                output[output_used++] = (unsigned char)value;
+                if (FLUSH_LINES && (unsigned char)value == '\n')
+                        flush_output();
+        }
+}
+
+static void put_text(const char* text, unsigned int size)
+{
+        while (size--)
+                put((cell_t)(unsigned char)*text++, 1);
+}
+
+static void bind(void)
+{
+        low  = tape - LOWEST;      /* cells left of it are padding for negative offsets */
+        high = tape + tape_size - HIGHEST;
+}
+
+static cell_t* check(cell_t* p)
+{
+        size_t position;
+
+        if (p < low) {
+                flush_output();
+                fputs("Error: pc underflow\n", stderr);
+                exit(EXIT_FAILURE);
+        }
+
+        position = p - tape;
+
+        if (p >= high) {
+                size_t size = position + HIGHEST + 1000;
+
+                if (!(tape = realloc(tape, size * sizeof *tape))) {
+                        fputs("Error: out of memory\n", stderr);
+                        exit(EXIT_FAILURE);
+                }
+
+                memset(tape + tape_size, 0, (size - tape_size) * sizeof *tape);
+                tape_size = size;
+                bind();
+        }
+
+        return tape + position;
+}
+
+#define ADD(k, n)     p[k] = (cell_t)((ucell_t)p[k] + (ucell_t)(n))
+#define MULADD(k, n)  p[k] = (cell_t)(ucell_t)((unsigned long long)(ucell_t)p[k] + (unsigned long long)(ucell_t)p[0] * (ucell_t)(n))
+#define MOVE(n)       do { p += (n); if (p < low || p >= high) p = check(p); } while (0)
+#define REACH(k)      do { if (p + (k) < low) check(p + (k)); } while (0)
+
+int main(void)
+{
+        cell_t* p;
+
+        tape = calloc(tape_size, sizeof *tape);
+        bind();
+        p = check(tape - LOWEST);
+
+        {
+                static const ucell_t image[] = {
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 9ull, 0ull, 0ull, 0ull, 0ull,
+                        1ull, 1ull, 0ull, 0ull, 2ull, 1ull, 0ull, 0ull,
+                        3ull, 1ull, 0ull, 0ull, 4ull, 1ull, 0ull, 0ull,
+                        5ull, 1ull, 0ull, 0ull, 6ull, 1ull, 0ull, 0ull,
+                        7ull, 1ull, 0ull, 0ull, 8ull, 1ull, 0ull, 0ull,
+                        9ull, 0ull, 0ull, 0ull, 0ull, 0ull, 1ull, 2ull,
+                        8ull, 1ull, 1ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        120ull,
+                };
+
+                p = check(p + sizeof image / sizeof *image) - sizeof image / sizeof *image;
+                memcpy(p, image, sizeof image);
+        }
+        MOVE(250);
+        put_text("\033[H\033[2J\033[2;27HTowers of Hanoi in Brainf*ck\033[3;15HWritten by Clif", 64);
+        put_text("ford Wolf <http://www.clifford.at/bfcpu/>\033[14;43H---------------", 64);
+        put_text("--------------------\033[24;23H-----------------------------------\033", 64);
+        put_text("[14;3H-----------------------------------\033[13;3HxXXXXXXXXXXXXXXX", 64);
+        put_text("XXXXXXXXXXXXXXXXXXx\033[12;5HxXXXXXXXXXXXXXXXXXXXXXXXXXXXXXx\033[11;7H", 64);
+        put_text("xXXXXXXXXXXXXXXXXXXXXXXXXXx\033[10;9HxXXXXXXXXXXXXXXXXXXXXXx\033[9;11H", 64);
+        put_text("xXXXXXXXXXXXXXXXXXx\033[8;13HxXXXXXXXXXXXXXx\033[7;15HxXXXXXXXXXx\033[6;1", 64);
+        put_text("7HxXXXXXx\033[5;19HxXx", 19);
+
+        while (p[0]) {
+                p[3] = 0;
+                p[4] = 0;
+                MOVE(-1);
+                MULADD(5, 1);
+                p[0] = 0;
+                MOVE(5);
+                MULADD(-5, 1);
+                MULADD(-1, 1);
+                p[0] = 0;
+                p[0] = 4;
+                REACH(-2);
+                p[-2] = 0;
+                p[1] = 0;
+                p[2] = 0;
+                MOVE(-1);
+                MULADD(3, 1);
+                p[0] = 0;
+                MOVE(3);
+                while (p[0]) {
+                        MULADD(-3, 1);
+                        p[0] = 0;
+                        p[1] = 0;
+                        MOVE(-2);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(3);
+                        while (p[0]) {
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                REACH(-2);
+                                p[-2] = 0;
+                                p[-2] = 1;
+                        }
+                        MOVE(-1);
+                }
+                MOVE(-1);
+                while (p[0]) {
+                        REACH(-2);
+                        ADD(-2, -1);
+                        ADD(-1, -1);
+                        p[0] = 0;
+                        p[1] = 0;
+                        MOVE(-2);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(3);
+                        while (p[0]) {
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                }
+                MOVE(-2);
+                MULADD(2, 1);
+                p[0] = 0;
+                MOVE(2);
+                while (p[0]) {
+                        MULADD(-2, 1);
+                        p[0] = 0;
+                        REACH(-3);
+                        p[-3] = 0;
+                        p[-3] = 1;
+                }
+                MOVE(-1);
+                MULADD(1, 1);
+                p[0] = 0;
+                MOVE(1);
+                while (p[0]) {
+                        MULADD(-1, 1);
+                        p[0] = 0;
+                        REACH(-3);
+                        p[-3] = 0;
+                        p[-3] = 1;
+                }
+                MOVE(-3);
+                while (p[0]) {
+                        p[1] = 0;
+                        MOVE(-4);
+                        MULADD(5, 1);
+                        p[0] = 0;
+                        MOVE(5);
+                        while (p[0]) {
+                                MULADD(-5, 1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                p[2] = 0;
+                                p[3] = 0;
+                                p[5] = 0;
+                                p[6] = 0;
+                                MOVE(-4);
+                                MULADD(10, 1);
+                                p[0] = 0;
+                                MOVE(10);
+                                MULADD(-10, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                REACH(-2);
+                                p[-2] = 0;
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-3] = 1;
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-8);
+                                MULADD(10, 1);
+                                p[0] = 0;
+                                MOVE(10);
+                                MULADD(-10, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 3;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-3] = 1;
+                                        p[-1] = 0;
+                                        p[-1] = 1;
+                                }
+                                MOVE(-3);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        p[3] = 0;
+                                        MOVE(-12);
+                                        MULADD(15, 1);
+                                        p[0] = 0;
+                                        p[14] = 0;
+                                        MOVE(15);
+                                        MULADD(-15, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        MOVE(-13);
+                                        MULADD(14, 1);
+                                        p[0] = 0;
+                                        MOVE(14);
+                                        MULADD(-14, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(-1, 3);
+                                        p[0] = 0;
+                                        MOVE(-12);
+                                        MULADD(13, 1);
+                                        p[0] = 0;
+                                        MOVE(13);
+                                        MULADD(-13, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(-1, 9);
+                                        p[0] = 0;
+                                        REACH(-219);
+                                        p[-219] = 0;
+                                        REACH(-220);
+                                        p[-220] = 0;
+                                        REACH(-221);
+                                        p[-221] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        MULADD(-220, 1);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-16);
+                                        MULADD(16, 1);
+                                        p[0] = 0;
+                                        MOVE(16);
+                                        MULADD(-221, 1);
+                                        MULADD(-16, 1);
+                                        p[0] = 0;
+                                        MOVE(-221);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, -1);
+                                                MOVE(-1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        MOVE(1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        while (p[0])
+                                                MOVE(4);
+                                        p[42] = 0;
+                                        p[41] = 0;
+                                        p[40] = 0;
+                                        p[222] = 0;
+                                        MOVE(210);
+                                        MULADD(12, 1);
+                                        p[0] = 0;
+                                        MOVE(12);
+                                        MULADD(-180, 1);
+                                        MULADD(-12, 1);
+                                        p[0] = 0;
+                                        MOVE(-16);
+                                        MULADD(16, 1);
+                                        p[0] = 0;
+                                        MOVE(16);
+                                        MULADD(-181, 1);
+                                        MULADD(-16, 1);
+                                        p[0] = 0;
+                                        MOVE(-181);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, -1);
+                                                MOVE(-1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        MOVE(1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        while (p[0])
+                                                MOVE(4);
+                                        p[42] = 0;
+                                        p[41] = 0;
+                                        p[40] = 0;
+                                        p[182] = 0;
+                                        MOVE(171);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        MOVE(11);
+                                        MULADD(-140, 1);
+                                        MULADD(-11, 1);
+                                        p[0] = 0;
+                                        MOVE(-16);
+                                        MULADD(16, 1);
+                                        p[0] = 0;
+                                        MOVE(16);
+                                        MULADD(-141, 1);
+                                        MULADD(-16, 1);
+                                        p[0] = 0;
+                                        MOVE(-141);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, -1);
+                                                MOVE(-1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        MOVE(1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        while (p[0])
+                                                MOVE(4);
+                                        ADD(126, 1);
+                                        MOVE(139);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-11);
+                                        MULADD(12, 1);
+                                        p[0] = 0;
+                                        p[5] = 0;
+                                        MOVE(12);
+                                        MULADD(-12, 1);
+                                        MULADD(-7, 1);
+                                        p[0] = 0;
+                                        MOVE(-11);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        p[-1] = 0;
+                                        MOVE(11);
+                                        MULADD(-12, 1);
+                                        MULADD(-11, 1);
+                                        p[0] = 0;
+                                        MOVE(-7);
+                                        MULADD(7, 1);
+                                        p[0] = 0;
+                                        REACH(-4);
+                                        p[-4] = 0;
+                                        MOVE(7);
+                                        MULADD(-11, 1);
+                                        MULADD(-7, 1);
+                                        p[0] = 0;
+                                        REACH(-10);
+                                        ADD(-10, -1);
+                                        p[-9] = 0;
+                                        ADD(-8, 1);
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-11);
+                                        MULADD(12, 1);
+                                        p[0] = 0;
+                                        p[5] = 0;
+                                        MOVE(12);
+                                        MULADD(-12, 1);
+                                        MULADD(-7, 1);
+                                        p[0] = 0;
+                                        MOVE(-13);
+                                        MULADD(13, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(13);
+                                        MULADD(-13, 1);
+                                        MULADD(-12, 1);
+                                        p[0] = 0;
+                                        MOVE(-7);
+                                        MULADD(7, 1);
+                                        p[0] = 0;
+                                        REACH(-6);
+                                        p[-6] = 0;
+                                        MOVE(7);
+                                        MULADD(-13, 1);
+                                        MULADD(-7, 1);
+                                        p[0] = 0;
+                                        REACH(-10);
+                                        ADD(-10, -1);
+                                        p[-9] = 0;
+                                        ADD(-8, 1);
+                                        MOVE(-1);
+                                }
+                                MOVE(-4);
+                        }
+                        p[1] = 0;
+                        p[2] = 0;
+                        MOVE(-4);
+                        MULADD(6, 1);
+                        p[0] = 0;
+                        MOVE(6);
+                        MULADD(-6, 1);
+                        MULADD(-1, 1);
+                        p[0] = 0;
+                        p[0] = 2;
+                        REACH(-2);
+                        p[-2] = 1;
+                        p[1] = 0;
+                        p[2] = 0;
+                        MOVE(-1);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(3);
+                        while (p[0]) {
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                        while (p[0]) {
+                                REACH(-2);
+                                ADD(-2, -1);
+                                ADD(-1, -1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-2);
+                        MULADD(2, 1);
+                        p[0] = 0;
+                        MOVE(2);
+                        while (p[0]) {
+                                MULADD(-2, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                        }
+                        MOVE(-1);
+                        MULADD(1, 1);
+                        p[0] = 0;
+                        MOVE(1);
+                        while (p[0]) {
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                        }
+                        MOVE(-3);
+                        while (p[0]) {
+                                p[0] = 0;
+                                p[4] = 0;
+                                p[4] = 2;
+                                p[6] = 0;
+                                p[7] = 0;
+                                MOVE(-8);
+                                MULADD(15, 1);
+                                p[0] = 0;
+                                MOVE(15);
+                                MULADD(-15, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-2);
+                                p[-2] = 0;
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-55);
+                                        MULADD(56, 1);
+                                        p[0] = 0;
+                                        p[52] = 0;
+                                        MOVE(56);
+                                        MULADD(-56, 1);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-13);
+                                MULADD(15, 1);
+                                p[0] = 0;
+                                MOVE(15);
+                                MULADD(-15, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-137);
+                                        MULADD(138, 1);
+                                        p[0] = 0;
+                                        p[134] = 0;
+                                        MOVE(138);
+                                        MULADD(-138, 1);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-13);
+                                MULADD(15, 1);
+                                p[0] = 0;
+                                MOVE(15);
+                                MULADD(-15, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 2;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-96);
+                                        MULADD(97, 1);
+                                        p[0] = 0;
+                                        p[93] = 0;
+                                        MOVE(97);
+                                        MULADD(-97, 1);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-13);
+                                MULADD(15, 1);
+                                p[0] = 0;
+                                MOVE(15);
+                                MULADD(-15, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-55);
+                                        ADD(-55, -1);
+                                        p[-15] = 0;
+                                        p[-16] = 0;
+                                        p[-17] = 0;
+                                        p[-4] = 0;
+                                        p[1] = 0;
+                                        MOVE(-55);
+                                        MULADD(56, 1);
+                                        p[0] = 0;
+                                        MOVE(56);
+                                        MULADD(-56, 1);
+                                        MULADD(-17, 1);
+                                        p[0] = 0;
+                                        MOVE(-17);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                ADD(0, -1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                MOVE(2);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                        }
+                                        MOVE(2);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        MOVE(15);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-13);
+                                MULADD(15, 1);
+                                p[0] = 0;
+                                MOVE(15);
+                                MULADD(-15, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-137);
+                                        ADD(-137, -1);
+                                        p[-97] = 0;
+                                        p[-98] = 0;
+                                        p[-99] = 0;
+                                        p[-4] = 0;
+                                        p[1] = 0;
+                                        MOVE(-137);
+                                        MULADD(138, 1);
+                                        p[0] = 0;
+                                        MOVE(138);
+                                        MULADD(-138, 1);
+                                        MULADD(-99, 1);
+                                        p[0] = 0;
+                                        MOVE(-99);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                ADD(0, -1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                MOVE(2);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                        }
+                                        MOVE(2);
+                                        MULADD(93, 1);
+                                        p[0] = 0;
+                                        MOVE(97);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-13);
+                                MULADD(15, 1);
+                                p[0] = 0;
+                                MOVE(15);
+                                MULADD(-15, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 2;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-96);
+                                        ADD(-96, -1);
+                                        p[-56] = 0;
+                                        p[-57] = 0;
+                                        p[-58] = 0;
+                                        p[-4] = 0;
+                                        p[1] = 0;
+                                        MOVE(-96);
+                                        MULADD(97, 1);
+                                        p[0] = 0;
+                                        MOVE(97);
+                                        MULADD(-97, 1);
+                                        MULADD(-58, 1);
+                                        p[0] = 0;
+                                        MOVE(-58);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                ADD(0, -1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                MOVE(2);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                        }
+                                        MOVE(2);
+                                        MULADD(52, 1);
+                                        p[0] = 0;
+                                        MOVE(56);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-11);
+                                MULADD(13, 1);
+                                p[0] = 0;
+                                MOVE(13);
+                                MULADD(-13, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-15);
+                                        p[-15] = 0;
+                                        REACH(-16);
+                                        p[-16] = 0;
+                                        REACH(-17);
+                                        p[-17] = 0;
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-16, 1);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-56);
+                                        MULADD(56, 1);
+                                        p[0] = 0;
+                                        MOVE(56);
+                                        MULADD(-56, 1);
+                                        MULADD(-17, 1);
+                                        p[0] = 0;
+                                        MOVE(-17);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, -1);
+                                                MOVE(-1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        MOVE(1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        while (p[0])
+                                                MOVE(4);
+                                        REACH(-38);
+                                        ADD(-38, 1);
+                                        MOVE(17);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-11);
+                                MULADD(13, 1);
+                                p[0] = 0;
+                                MOVE(13);
+                                MULADD(-13, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-97);
+                                        p[-97] = 0;
+                                        REACH(-98);
+                                        p[-98] = 0;
+                                        REACH(-99);
+                                        p[-99] = 0;
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-98, 1);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-138);
+                                        MULADD(138, 1);
+                                        p[0] = 0;
+                                        MOVE(138);
+                                        MULADD(-138, 1);
+                                        MULADD(-99, 1);
+                                        p[0] = 0;
+                                        MOVE(-99);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, -1);
+                                                MOVE(-1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        MOVE(1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        while (p[0])
+                                                MOVE(4);
+                                        REACH(-38);
+                                        ADD(-38, 1);
+                                        MOVE(99);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-11);
+                                MULADD(13, 1);
+                                p[0] = 0;
+                                MOVE(13);
+                                MULADD(-13, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 2;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        REACH(-56);
+                                        p[-56] = 0;
+                                        REACH(-57);
+                                        p[-57] = 0;
+                                        REACH(-58);
+                                        p[-58] = 0;
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-57, 1);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-97);
+                                        MULADD(97, 1);
+                                        p[0] = 0;
+                                        MOVE(97);
+                                        MULADD(-97, 1);
+                                        MULADD(-58, 1);
+                                        p[0] = 0;
+                                        MOVE(-58);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                REACH(-4);
+                                                p[-4] = 0;
+                                                REACH(-5);
+                                                p[-5] = 0;
+                                                p[-5] = 1;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, -1);
+                                                MOVE(-1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        MOVE(1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        while (p[0])
+                                                MOVE(4);
+                                        REACH(-38);
+                                        ADD(-38, 1);
+                                        MOVE(58);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-11);
+                                MULADD(13, 1);
+                                p[0] = 0;
+                                MOVE(13);
+                                MULADD(-13, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-55);
+                                        MULADD(56, 1);
+                                        p[0] = 0;
+                                        p[53] = 0;
+                                        MOVE(56);
+                                        MULADD(-56, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-11);
+                                MULADD(13, 1);
+                                p[0] = 0;
+                                MOVE(13);
+                                MULADD(-13, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-137);
+                                        MULADD(138, 1);
+                                        p[0] = 0;
+                                        p[135] = 0;
+                                        MOVE(138);
+                                        MULADD(-138, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                }
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-11);
+                                MULADD(13, 1);
+                                p[0] = 0;
+                                MOVE(13);
+                                MULADD(-13, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 2;
+                                REACH(-2);
+                                p[-2] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                MOVE(-1);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                }
+                                MOVE(-3);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-96);
+                                        MULADD(97, 1);
+                                        p[0] = 0;
+                                        p[94] = 0;
+                                        MOVE(97);
+                                        MULADD(-97, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        p[4] = 0;
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        p[5] = 0;
+                                        p[5] = 1;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[2] = 0;
+                                                MOVE(-16);
+                                                MULADD(18, 1);
+                                                p[0] = 0;
+                                                p[13] = 0;
+                                                MOVE(18);
+                                                MULADD(-18, 1);
+                                                MULADD(-5, 1);
+                                                p[0] = 0;
+                                                MOVE(-8);
+                                                MULADD(8, 1);
+                                                p[0] = 0;
+                                                p[4] = 0;
+                                                MOVE(8);
+                                                MULADD(-8, 1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                p[-3] = 32;
+                                                ADD(-1, -1);
+                                                MOVE(-2);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-15);
+                                                MULADD(16, 1);
+                                                p[0] = 0;
+                                                p[11] = 0;
+                                                MOVE(16);
+                                                MULADD(-16, 1);
+                                                MULADD(-5, 1);
+                                                p[0] = 0;
+                                                MOVE(-7);
+                                                MULADD(7, 1);
+                                                p[0] = 0;
+                                                p[3] = 0;
+                                                MOVE(7);
+                                                MULADD(-7, 1);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                                p[-3] = 88;
+                                                MOVE(-1);
+                                        }
+                                        REACH(-1);
+                                        p[-1] = 0;
+                                        p[-1] = 16;
+                                        p[0] = 14;
+                                        p[4] = 0;
+                                        p[5] = 0;
+                                        MOVE(-4);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(9);
+                                        MULADD(-9, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-4);
+                                                ADD(-4, 5);
+                                        }
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-7);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(9);
+                                        MULADD(-9, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        REACH(-2);
+                                        p[-2] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                ADD(-3, 10);
+                                        }
+                                        p[1] = 0;
+                                        MOVE(-7);
+                                        MULADD(8, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                        MULADD(-8, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 25;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[2] = 0;
+                                                MOVE(1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                                MULADD(-4, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                                MOVE(-2);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        MULADD(-4, 1);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-11);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        MOVE(11);
+                                        MULADD(-11, 1);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        MOVE(-11);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        MOVE(11);
+                                        MULADD(-11, 1);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-7);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(9);
+                                        MULADD(-9, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 2;
+                                        REACH(-2);
+                                        p[-2] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-4);
+                                                ADD(-4, -5);
+                                        }
+                                        MOVE(-6);
+                                        MULADD(6, 1);
+                                        p[0] = 0;
+                                        MOVE(6);
+                                        MULADD(-6, 1);
+                                        MULADD(-3, -1);
+                                        p[0] = 0;
+                                        p[0] = 27;
+                                        put(p[0], 1);
+                                        p[0] = 91;
+                                        put(p[0], 1);
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-3);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        MOVE(-1);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[3] = 0;
+                                        MOVE(2);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                MULADD(-7, 1);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(-5, -1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-2] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        REACH(-5);
+                                        p[-5] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                p[0] = 1;
+                                                p[1] = 0;
+                                                MOVE(-1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        REACH(-1);
+                                                        p[-1] = 0;
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-7);
+                                                        ADD(-7, 1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[3] = 0;
+                                        MOVE(2);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                MULADD(-6, 1);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(-4, -1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-2] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        REACH(-5);
+                                        p[-5] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                p[0] = 1;
+                                                p[1] = 0;
+                                                MOVE(-1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        REACH(-1);
+                                                        p[-1] = 0;
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-7);
+                                                        ADD(-7, 1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        REACH(-1);
+                                        p[-1] = 0;
+                                        p[3] = 0;
+                                        MOVE(2);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                MULADD(-5, 1);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(-3, -1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-2] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        REACH(-5);
+                                        p[-5] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                p[0] = 1;
+                                                p[1] = 0;
+                                                MOVE(-1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        REACH(-1);
+                                                        p[-1] = 0;
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-7);
+                                                        ADD(-7, 1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        p[2] = 0;
+                                        p[2] = 1;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, 48);
+                                                put(p[-1], 1);
+                                                REACH(-2);
+                                                ADD(-2, 48);
+                                                put(p[-2], 1);
+                                                REACH(-3);
+                                                ADD(-3, 48);
+                                                put(p[-3], 1);
+                                                ADD(1, -1);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                p[5] = 0;
+                                                p[5] = 1;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        REACH(-4);
+                                                        ADD(-4, 48);
+                                                        put(p[-4], 1);
+                                                        REACH(-5);
+                                                        ADD(-5, 48);
+                                                        put(p[-5], 1);
+                                                        ADD(1, -1);
+                                                }
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-6);
+                                                        ADD(-6, 48);
+                                                        put(p[-6], 1);
+                                                }
+                                                MOVE(-2);
+                                        }
+                                        REACH(-6);
+                                        ADD(-6, -32);
+                                        put(p[-6], 1);
+                                        p[-5] = 0;
+                                        p[-4] = 0;
+                                        MOVE(-10);
+                                        MULADD(6, 1);
+                                        p[0] = 0;
+                                        MOVE(6);
+                                        MULADD(-6, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[3] = 0;
+                                        MOVE(-1);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[3] = 0;
+                                        MOVE(2);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                MULADD(-7, 1);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(-5, -1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-2] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        REACH(-5);
+                                        p[-5] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                p[0] = 1;
+                                                p[1] = 0;
+                                                MOVE(-1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        REACH(-1);
+                                                        p[-1] = 0;
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-7);
+                                                        ADD(-7, 1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[3] = 0;
+                                        MOVE(2);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                MULADD(-6, 1);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(-4, -1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-2] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        REACH(-5);
+                                        p[-5] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                p[0] = 1;
+                                                p[1] = 0;
+                                                MOVE(-1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        REACH(-1);
+                                                        p[-1] = 0;
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-7);
+                                                        ADD(-7, 1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        p[1] = 0;
+                                        MOVE(-4);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        REACH(-1);
+                                        p[-1] = 0;
+                                        p[3] = 0;
+                                        MOVE(2);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                MULADD(-5, 1);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(-3, -1);
+                                                p[0] = 0;
+                                                MOVE(1);
+                                        }
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-2] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 10;
+                                        REACH(-5);
+                                        p[-5] = 0;
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[3] = 0;
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        REACH(-3);
+                                                        ADD(-3, -1);
+                                                        ADD(-1, -1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(4);
+                                                        while (p[0]) {
+                                                                MULADD(-4, 1);
+                                                                p[0] = 0;
+                                                                p[1] = 0;
+                                                                MOVE(-2);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(3);
+                                                                while (p[0]) {
+                                                                        MULADD(-3, 1);
+                                                                        p[0] = 0;
+                                                                        REACH(-2);
+                                                                        p[-2] = 0;
+                                                                        p[-2] = 1;
+                                                                }
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                p[0] = 1;
+                                                p[1] = 0;
+                                                MOVE(-1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        REACH(-1);
+                                                        p[-1] = 0;
+                                                }
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-7);
+                                                        ADD(-7, 1);
+                                                }
+                                                MOVE(-3);
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        p[2] = 0;
+                                        p[2] = 1;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                ADD(-1, 48);
+                                                put(p[-1], 1);
+                                                REACH(-2);
+                                                ADD(-2, 48);
+                                                put(p[-2], 1);
+                                                REACH(-3);
+                                                ADD(-3, 48);
+                                                put(p[-3], 1);
+                                                ADD(1, -1);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                p[5] = 0;
+                                                p[5] = 1;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        REACH(-4);
+                                                        ADD(-4, 48);
+                                                        put(p[-4], 1);
+                                                        REACH(-5);
+                                                        ADD(-5, 48);
+                                                        put(p[-5], 1);
+                                                        ADD(1, -1);
+                                                }
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        p[0] = 0;
+                                                        REACH(-6);
+                                                        ADD(-6, 48);
+                                                        put(p[-6], 1);
+                                                }
+                                                MOVE(-2);
+                                        }
+                                        REACH(-6);
+                                        ADD(-6, 13);
+                                        put(p[-6], 1);
+                                        p[-5] = 0;
+                                        p[-4] = 0;
+                                        MOVE(-11);
+                                        MULADD(7, 1);
+                                        p[0] = 0;
+                                        MOVE(7);
+                                        MULADD(-7, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 88;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                p[2] = 0;
+                                                p[2] = 120;
+                                                put(p[2], 1);
+                                                ADD(1, -1);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-6);
+                                                put(p[-6], 1);
+                                        }
+                                        REACH(-1);
+                                        p[-1] = 0;
+                                        MOVE(-12);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        p[9] = 0;
+                                        MOVE(11);
+                                        MULADD(-11, 1);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                        }
+                                        MOVE(-2);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                put(p[-3], 2);
+                                                ADD(0, -1);
+                                        }
+                                        REACH(-3);
+                                        put(p[-3], 1);
+                                        p[2] = 0;
+                                        MOVE(-9);
+                                        MULADD(11, 1);
+                                        p[0] = 0;
+                                        MOVE(11);
+                                        MULADD(-11, 1);
+                                        MULADD(-2, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                        }
+                                        MOVE(-2);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                put(p[-3], 2);
+                                                ADD(0, -1);
+                                        }
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        MOVE(-3);
+                                        MULADD(7, 1);
+                                        p[0] = 0;
+                                        MOVE(7);
+                                        MULADD(-7, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[0] = 88;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        MOVE(-1);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-2);
+                                                ADD(-2, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                REACH(-3);
+                                                p[-3] = 0;
+                                        }
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                p[2] = 0;
+                                                p[2] = 120;
+                                                put(p[2], 1);
+                                                ADD(1, -1);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-6);
+                                                put(p[-6], 1);
+                                        }
+                                        MOVE(-9);
+                                }
+                                p[1] = 0;
+                                p[1] = 10;
+                                put(p[1], 1);
+                                p[1] = 1;
+                                p[2] = 0;
+                                p[3] = 0;
+                                p[3] = 27;
+                                put(p[3], 1);
+                                p[3] = 91;
+                                put(p[3], 1);
+                                p[4] = 0;
+                                p[5] = 0;
+                                p[2] = 1;
+                                p[5] = 0;
+                                p[8] = 0;
+                                p[9] = 0;
+                                p[4] = 1;
+                                p[8] = 1;
+                                p[9] = 10;
+                                p[10] = 0;
+                                MOVE(8);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[3] = 0;
+                                MOVE(2);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        MULADD(-7, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(-5, -1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-2] = 0;
+                                MOVE(-7);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                REACH(-5);
+                                p[-5] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                p[-1] = 0;
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                p[1] = 0;
+                                MOVE(-4);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                p[1] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                REACH(-2);
+                                p[-2] = 0;
+                                p[3] = 0;
+                                MOVE(2);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        MULADD(-6, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-2] = 0;
+                                MOVE(-7);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                REACH(-5);
+                                p[-5] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                p[-1] = 0;
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                p[1] = 0;
+                                MOVE(-4);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                p[1] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                REACH(-1);
+                                p[-1] = 0;
+                                p[3] = 0;
+                                MOVE(2);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        MULADD(-5, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(-3, -1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-2] = 0;
+                                MOVE(-7);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                REACH(-5);
+                                p[-5] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                p[-1] = 0;
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                p[2] = 0;
+                                p[2] = 1;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 48);
+                                        put(p[-1], 1);
+                                        REACH(-2);
+                                        ADD(-2, 48);
+                                        put(p[-2], 1);
+                                        REACH(-3);
+                                        ADD(-3, 48);
+                                        put(p[-3], 1);
+                                        ADD(1, -1);
+                                }
+                                MOVE(1);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        p[5] = 0;
+                                        p[5] = 1;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-4);
+                                                ADD(-4, 48);
+                                                put(p[-4], 1);
+                                                REACH(-5);
+                                                ADD(-5, 48);
+                                                put(p[-5], 1);
+                                                ADD(1, -1);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-6);
+                                                ADD(-6, 48);
+                                                put(p[-6], 1);
+                                        }
+                                        MOVE(-2);
+                                }
+                                REACH(-6);
+                                ADD(-6, -32);
+                                put(p[-6], 1);
+                                p[-5] = 0;
+                                p[-4] = 0;
+                                MOVE(-8);
+                                MULADD(4, 1);
+                                p[0] = 0;
+                                MOVE(4);
+                                MULADD(-4, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[3] = 0;
+                                MOVE(-1);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                p[1] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[3] = 0;
+                                MOVE(2);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        MULADD(-7, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(-5, -1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-2] = 0;
+                                MOVE(-7);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                REACH(-5);
+                                p[-5] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                p[-1] = 0;
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                p[1] = 0;
+                                MOVE(-4);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                p[1] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                REACH(-2);
+                                p[-2] = 0;
+                                p[3] = 0;
+                                MOVE(2);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        MULADD(-6, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-2] = 0;
+                                MOVE(-7);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                REACH(-5);
+                                p[-5] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                p[-1] = 0;
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                p[1] = 0;
+                                MOVE(-4);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                p[1] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                REACH(-1);
+                                p[-1] = 0;
+                                p[3] = 0;
+                                MOVE(2);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        MULADD(-5, 1);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-2);
+                                        MULADD(-3, -1);
+                                        p[0] = 0;
+                                        MOVE(1);
+                                }
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-2] = 0;
+                                MOVE(-7);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                p[0] = 10;
+                                REACH(-5);
+                                p[-5] = 0;
+                                MOVE(-1);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        MOVE(1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(2);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                REACH(-3);
+                                                ADD(-3, -1);
+                                                ADD(-1, -1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-3);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                                while (p[0]) {
+                                                        MULADD(-4, 1);
+                                                        p[0] = 0;
+                                                        p[1] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                MULADD(-3, 1);
+                                                                p[0] = 0;
+                                                                REACH(-2);
+                                                                p[-2] = 0;
+                                                                p[-2] = 1;
+                                                        }
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        MOVE(-1);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(2);
+                                        while (p[0]) {
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                REACH(-1);
+                                                p[-1] = 0;
+                                        }
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                        }
+                                        MOVE(-3);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                p[2] = 0;
+                                p[2] = 1;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 48);
+                                        put(p[-1], 1);
+                                        REACH(-2);
+                                        ADD(-2, 48);
+                                        put(p[-2], 1);
+                                        REACH(-3);
+                                        ADD(-3, 48);
+                                        put(p[-3], 1);
+                                        ADD(1, -1);
+                                }
+                                MOVE(1);
+                                while (p[0]) {
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-3);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        p[5] = 0;
+                                        p[5] = 1;
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                REACH(-4);
+                                                ADD(-4, 48);
+                                                put(p[-4], 1);
+                                                REACH(-5);
+                                                ADD(-5, 48);
+                                                put(p[-5], 1);
+                                                ADD(1, -1);
+                                        }
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[0] = 0;
+                                                REACH(-6);
+                                                ADD(-6, 48);
+                                                put(p[-6], 1);
+                                        }
+                                        MOVE(-2);
+                                }
+                                REACH(-6);
+                                ADD(-6, 13);
+                                put(p[-6], 1);
+                                REACH(-8);
+                                p[-8] = 0;
+                                ADD(-8, 200);
+                                MOVE(-8);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(1, 200);
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                p[1] = 0;
+                                                p[1] = 0;
+                                                ADD(0, -1);
+                                        }
+                                        REACH(-1);
+                                        ADD(-1, -1);
+                                        MOVE(-1);
+                                }
+                                MOVE(-5);
+                        }
+                        REACH(-4);
+                        ADD(-4, 1);
+                        p[1] = 0;
+                        MOVE(-4);
+                        MULADD(5, 1);
+                        p[0] = 0;
+                        MOVE(5);
+                        MULADD(-5, 1);
+                        MULADD(-1, 1);
+                        p[0] = 0;
+                        p[0] = 4;
+                        REACH(-2);
+                        p[-2] = 0;
+                        p[1] = 0;
+                        p[2] = 0;
+                        MOVE(-1);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(3);
+                        while (p[0]) {
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                        while (p[0]) {
+                                REACH(-2);
+                                ADD(-2, -1);
+                                ADD(-1, -1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-2);
+                        MULADD(2, 1);
+                        p[0] = 0;
+                        MOVE(2);
+                        while (p[0]) {
+                                MULADD(-2, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-3] = 1;
+                        }
+                        MOVE(-1);
+                        MULADD(1, 1);
+                        p[0] = 0;
+                        MOVE(1);
+                        while (p[0]) {
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-3] = 1;
+                        }
+                        MOVE(-3);
+                }
+                REACH(-2);
+                ADD(-2, -1);
+                MOVE(-2);
+                MULADD(2, 1);
+                p[0] = 0;
+                MOVE(2);
+                while (p[0]) {
+                        MULADD(-2, 1);
+                        p[0] = 0;
+                        REACH(-8);
+                        ADD(-8, -1);
+                        REACH(-212);
+                        p[-212] = 0;
+                        REACH(-213);
+                        p[-213] = 0;
+                        REACH(-214);
+                        p[-214] = 0;
+                        p[-7] = 0;
+                        p[1] = 0;
+                        MOVE(-8);
+                        MULADD(9, 1);
+                        p[0] = 0;
+                        MOVE(9);
+                        MULADD(-214, 1);
+                        MULADD(-9, 1);
+                        p[0] = 0;
+                        MOVE(-214);
+                        while (p[0]) {
+                                REACH(-3);
+                                p[-3] = 0;
+                                REACH(-4);
+                                p[-4] = 0;
+                                REACH(-5);
+                                p[-5] = 0;
+                                p[-5] = 1;
+                                ADD(0, -1);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                        }
+                        MOVE(-2);
+                        MULADD(2, 1);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(2);
+                        MULADD(-2, 1);
+                        p[0] = 0;
+                        MOVE(-1);
+                        while (p[0]) {
+                                MOVE(2);
+                                MULADD(4, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                        }
+                        MOVE(2);
+                        MULADD(205, 1);
+                        p[0] = 0;
+                        p[40] = 0;
+                        p[39] = 0;
+                        p[38] = 0;
+                        p[208] = 0;
+                        p[213] = 0;
+                        MOVE(204);
+                        MULADD(9, 1);
+                        p[0] = 0;
+                        MOVE(9);
+                        MULADD(-174, 1);
+                        MULADD(-9, 1);
+                        p[0] = 0;
+                        MOVE(-174);
+                        while (p[0]) {
+                                REACH(-3);
+                                p[-3] = 0;
+                                REACH(-4);
+                                p[-4] = 0;
+                                REACH(-5);
+                                p[-5] = 0;
+                                p[-5] = 1;
+                                ADD(0, -1);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                        }
+                        MOVE(-2);
+                        MULADD(2, 1);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(2);
+                        MULADD(-2, 1);
+                        p[0] = 0;
+                        MOVE(-1);
+                        while (p[0]) {
+                                MOVE(2);
+                                MULADD(4, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                        }
+                        MOVE(2);
+                        MULADD(168, 1);
+                        p[0] = 0;
+                        p[40] = 0;
+                        p[39] = 0;
+                        p[38] = 0;
+                        p[169] = 0;
+                        p[173] = 0;
+                        MOVE(164);
+                        MULADD(9, 1);
+                        p[0] = 0;
+                        MOVE(9);
+                        MULADD(-134, 1);
+                        MULADD(-9, 1);
+                        p[0] = 0;
+                        MOVE(-134);
+                        while (p[0]) {
+                                REACH(-3);
+                                p[-3] = 0;
+                                REACH(-4);
+                                p[-4] = 0;
+                                REACH(-5);
+                                p[-5] = 0;
+                                p[-5] = 1;
+                                ADD(0, -1);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                        }
+                        MOVE(-2);
+                        MULADD(2, 1);
+                        MULADD(3, 1);
+                        p[0] = 0;
+                        MOVE(2);
+                        MULADD(-2, 1);
+                        p[0] = 0;
+                        MOVE(-1);
+                        while (p[0]) {
+                                MOVE(2);
+                                MULADD(4, 1);
+                                p[0] = 0;
+                                MOVE(2);
+                        }
+                        MOVE(2);
+                        MULADD(129, 1);
+                        p[0] = 0;
+                        p[126] = 0;
+                        p[127] = 0;
+                        p[134] = 0;
+                        p[135] = 0;
+                        p[136] = 0;
+                        MOVE(125);
+                        MULADD(11, 1);
+                        p[0] = 0;
+                        MOVE(11);
+                        MULADD(-11, 1);
+                        MULADD(-1, 1);
+                        p[0] = 0;
+                        REACH(-3);
+                        p[-3] = 0;
+                        p[1] = 0;
+                        p[1] = 8;
+                        p[-2] = 0;
+                        MOVE(1);
+                        while (p[0]) {
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                        while (p[0]) {
+                                REACH(-2);
+                                ADD(-2, -1);
+                                ADD(-1, -1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                        MULADD(1, 1);
+                        p[0] = 0;
+                        MOVE(1);
+                        while (p[0]) {
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-3] = 1;
+                        }
+                        MOVE(-3);
+                        while (p[0]) {
+                                REACH(-8);
+                                ADD(-8, -9);
+                                ADD(-6, 1);
+                                p[1] = 0;
+                                p[2] = 0;
+                                p[3] = 0;
+                                MOVE(-8);
+                                MULADD(11, 1);
+                                p[0] = 0;
+                                MOVE(11);
+                                MULADD(-11, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[1] = 0;
+                                p[1] = 8;
+                                p[-2] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-3] = 1;
+                                }
+                                MOVE(-3);
+                        }
+                        p[1] = 0;
+                        p[2] = 0;
+                        p[3] = 0;
+                        MOVE(-8);
+                        MULADD(11, 1);
+                        p[0] = 0;
+                        MOVE(11);
+                        MULADD(-11, 1);
+                        MULADD(-1, 1);
+                        p[0] = 0;
+                        p[1] = 0;
+                        p[1] = 2;
+                        REACH(-2);
+                        p[-2] = 0;
+                        MOVE(1);
+                        while (p[0]) {
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 0;
+                                        p[-2] = 1;
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                        while (p[0]) {
+                                REACH(-2);
+                                ADD(-2, -1);
+                                ADD(-1, -1);
+                                p[0] = 0;
+                                p[1] = 0;
+                                MOVE(-2);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                        }
+                        MOVE(-1);
+                        MULADD(1, 1);
+                        p[0] = 0;
+                        MOVE(1);
+                        while (p[0]) {
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[-3] = 1;
+                        }
+                        MOVE(-3);
+                        while (p[0]) {
+                                REACH(-8);
+                                ADD(-8, -3);
+                                ADD(-7, 1);
+                                p[1] = 0;
+                                p[2] = 0;
+                                p[3] = 0;
+                                MOVE(-8);
+                                MULADD(11, 1);
+                                p[0] = 0;
+                                MOVE(11);
+                                MULADD(-11, 1);
+                                MULADD(-1, 1);
+                                p[0] = 0;
+                                REACH(-3);
+                                p[-3] = 0;
+                                p[1] = 0;
+                                p[1] = 2;
+                                p[-2] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                REACH(-2);
+                                                p[-2] = 0;
+                                                p[-2] = 1;
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                while (p[0]) {
+                                        REACH(-2);
+                                        ADD(-2, -1);
+                                        ADD(-1, -1);
+                                        p[0] = 0;
+                                        p[1] = 0;
+                                        MOVE(-2);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                p[1] = 0;
+                                                MOVE(-2);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        REACH(-2);
+                                                        p[-2] = 0;
+                                                        p[-2] = 1;
+                                                }
+                                                MOVE(-1);
+                                        }
+                                        MOVE(-1);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        MULADD(-1, 1);
+                                        p[0] = 0;
+                                        REACH(-3);
+                                        p[-3] = 0;
+                                        p[-3] = 1;
+                                }
+                                MOVE(-3);
+                        }
+                        REACH(-4);
+                        ADD(-4, 1);
+                        MOVE(-1);
+                }
+                MOVE(-2);
+        }
+        MOVE(37);
+
+        flush_output();
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,2572 @@
+/* Generated by bf. */
+typedef unsigned char cell_t;
+typedef unsigned char ucell_t;
+
+#define LOWEST  -36
+#define HIGHEST 32
+
+#define FLUSH_LINES  0
+#define FLUSH_INPUT  1
+#define END_OF_INPUT -1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static cell_t* tape;
+static size_t  tape_size = 65536 - LOWEST;
+static cell_t* low;
+static cell_t* high;
+
+static unsigned char output[1 << 16];
+static size_t        output_used;
+
+static void flush_output(void)
+{
+        fwrite(output, 1, output_used, stdout);
+        fflush(stdout);
+        output_used = 0;
+}
+
+static void put(cell_t value, unsigned int count)
+{
+        while (count--) {
+                if (output_used == sizeof output)
+                        flush_output();
+                output[output_used++] = (unsigned char)value;
+                if (FLUSH_LINES && (unsigned char)value == '\n')
+                        flush_output();
+        }
+}
+
+static void bind(void)
+{
+        low  = tape - LOWEST;      /* cells left of it are padding for negative offsets */
+        high = tape + tape_size - HIGHEST;
+}
+
+static cell_t* check(cell_t* p)
+{
+        size_t position;
+
+        if (p < low) {
+                flush_output();
+                fputs("Error: pc underflow\n", stderr);
+                exit(EXIT_FAILURE);
+        }
+
+        position = p - tape;
+
+        if (p >= high) {
+                size_t size = position + HIGHEST + 1000;
+
+                if (!(tape = realloc(tape, size * sizeof *tape))) {
+                        fputs("Error: out of memory\n", stderr);
+                        exit(EXIT_FAILURE);
+                }
+
+                memset(tape + tape_size, 0, (size - tape_size) * sizeof *tape);
+                tape_size = size;
+                bind();
+        }
+
+        return tape + position;
+}
+
+#define ADD(k, n)     p[k] = (cell_t)((ucell_t)p[k] + (ucell_t)(n))
+#define MULADD(k, n)  p[k] = (cell_t)(ucell_t)((unsigned long long)(ucell_t)p[k] + (unsigned long long)(ucell_t)p[0] * (ucell_t)(n))
+#define MOVE(n)       do { p += (n); if (p < low || p >= high) p = check(p); } while (0)
+#define REACH(k)      do { if (p + (k) < low) check(p + (k)); } while (0)
+
+int main(void)
+{
+        cell_t* p;
+
+        tape = calloc(tape_size, sizeof *tape);
+        bind();
+        p = check(tape - LOWEST);
+
+        {
+                static const ucell_t image[] = {
+                        0ull, 26ull, 0ull, 0ull, 65ull, 32ull, 10ull, 0ull,
+                        0ull, 0ull, 1ull, 0ull, 0ull, 0ull, 0ull, 1ull,
+                        1ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 1ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 1ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 1ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 1ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 1ull, 1ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 1ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 1ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 1ull,
+                        1ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 1ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 1ull, 0ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 1ull, 0ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 1ull, 0ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 1ull, 0ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 1ull, 0ull,
+                        0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 0ull, 1ull,
+                };
+
+                p = check(p + sizeof image / sizeof *image) - sizeof image / sizeof *image;
+                memcpy(p, image, sizeof image);
+        }
+        MOVE(10);
+
+        while (p[0]) {
+                MOVE(6);
+                while (p[0]) {
+                        p[7] = 0;
+                        MOVE(9);
+                }
+                MOVE(-9);
+                while (p[0])
+                        MOVE(-9);
+                p[7] = 0;
+                p[7] = 1;
+                ADD(1, 4);
+                MOVE(1);
+                while (p[0]) {
+                        ADD(0, -1);
+                        MULADD(9, 1);
+                        p[0] = 0;
+                        MOVE(9);
+                }
+                ADD(6, 1);
+                p[0] = 7;
+                while (p[0]) {
+                        ADD(0, -1);
+                        MULADD(9, 1);
+                        p[0] = 0;
+                        MOVE(9);
+                }
+                ADD(6, 1);
+                MOVE(-10);
+                while (p[0])
+                        MOVE(-9);
+                MOVE(3);
+                while (p[0]) {
+                        p[0] = 0;
+                        MOVE(6);
+                        while (p[0]) {
+                                MOVE(7);
+                                MULADD(-6, 1);
+                                p[0] = 0;
+                                MOVE(-6);
+                                MULADD(1, 1);
+                                MULADD(4, 1);
+                                MULADD(6, 1);
+                                p[0] = 0;
+                                MOVE(8);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(9);
+                        while (p[0]) {
+                                MOVE(8);
+                                MULADD(-7, 1);
+                                p[0] = 0;
+                                MOVE(-7);
+                                MULADD(2, 1);
+                                MULADD(5, 1);
+                                MULADD(7, 1);
+                                p[0] = 0;
+                                MOVE(8);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(7);
+                        MULADD(-7, 1);
+                        p[0] = 0;
+                        MOVE(-7);
+                        MULADD(5, 1);
+                        MULADD(7, 1);
+                        p[0] = 0;
+                        ADD(9, 15);
+                        MOVE(9);
+                        while (p[0]) {
+                                while (p[0])
+                                        MOVE(9);
+                                p[0] = 1;
+                                p[1] = 0;
+                                p[2] = 0;
+                                p[3] = 0;
+                                p[4] = 0;
+                                p[5] = 0;
+                                p[6] = 0;
+                                p[7] = 0;
+                                p[8] = 0;
+                                p[9] = 0;
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, -1);
+                                MOVE(9);
+                        }
+                        p[0] = 1;
+                        while (p[0]) {
+                                ADD(1, 1);
+                                MOVE(9);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(9);
+                        while (p[0]) {
+                                ADD(1, -1);
+                                MOVE(5);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, 1);
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                MOVE(2);
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(2, 1);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                p[0] = 1;
+                                                MOVE(9);
+                                        }
+                                        MOVE(-8);
+                                        while (p[0])
+                                                MOVE(-9);
+                                }
+                                MOVE(9);
+                                while (p[0])
+                                        MOVE(9);
+                                MOVE(-9);
+                                while (p[0]) {
+                                        MOVE(1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(-10);
+                                }
+                                MOVE(1);
+                                MULADD(9, 1);
+                                p[0] = 0;
+                                REACH(-1);
+                                p[-1] = 1;
+                                MOVE(7);
+                        }
+                        MOVE(-9);
+                        while (p[0]) {
+                                p[1] = 0;
+                                ADD(0, -1);
+                                MOVE(4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        REACH(-4);
+                                        ADD(-4, 1);
+                                        MOVE(-3);
+                                        MULADD(-6, 1);
+                                        MULADD(-1, -1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                }
+                                MOVE(-3);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                REACH(-1);
+                                ADD(-1, 1);
+                                MOVE(-10);
+                        }
+                        MOVE(9);
+                        while (p[0]) {
+                                ADD(1, 1);
+                                MOVE(9);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(9);
+                        while (p[0]) {
+                                ADD(1, -1);
+                                MOVE(6);
+                                MULADD(-5, 1);
+                                p[0] = 0;
+                                MOVE(-5);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(5, 1);
+                                        MOVE(-1);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                MOVE(3);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-3);
+                                                MULADD(3, 1);
+                                                MULADD(4, 1);
+                                                p[0] = 0;
+                                                p[0] = 1;
+                                                MOVE(9);
+                                        }
+                                        MOVE(-8);
+                                        while (p[0])
+                                                MOVE(-9);
+                                }
+                                MOVE(9);
+                                while (p[0])
+                                        MOVE(9);
+                                MOVE(-9);
+                                while (p[0]) {
+                                        MOVE(2);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(-11);
+                                }
+                                MOVE(2);
+                                MULADD(9, 1);
+                                p[0] = 0;
+                                REACH(-2);
+                                p[-2] = 1;
+                                MOVE(6);
+                        }
+                        MOVE(-9);
+                        while (p[0]) {
+                                p[1] = 0;
+                                ADD(0, -1);
+                                MOVE(4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        REACH(-4);
+                                        ADD(-4, 1);
+                                        MOVE(-3);
+                                        MULADD(-6, 1);
+                                        MULADD(-1, -1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                }
+                                MOVE(-3);
+                                MULADD(3, 1);
+                                p[0] = 0;
+                                REACH(-1);
+                                ADD(-1, 1);
+                                MOVE(-10);
+                        }
+                        MOVE(9);
+                        while (p[0]) {
+                                MOVE(4);
+                                MULADD(-36, 1);
+                                p[0] = 0;
+                                MOVE(5);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        ADD(9, 15);
+                        MOVE(9);
+                        while (p[0]) {
+                                while (p[0])
+                                        MOVE(9);
+                                REACH(-9);
+                                ADD(-9, -1);
+                                MOVE(-18);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, -1);
+                                MOVE(9);
+                        }
+                        p[0] = 1;
+                        ADD(21, 1);
+                        MOVE(18);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(9);
+                        while (p[0]) {
+                                MOVE(3);
+                                MULADD(-3, -1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(-3);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(3, -1);
+                                        MOVE(4);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, 1);
+                                                MOVE(-9);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                                p[4] = 0;
+                                                p[4] = 1;
+                                                MOVE(9);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                ADD(1, 1);
+                                        }
+                                }
+                                p[0] = 1;
+                                MOVE(4);
+                                MULADD(-4, -1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, -1);
+                                        MOVE(3);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(3, 1);
+                                                MOVE(-9);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                                p[3] = 0;
+                                                p[3] = 1;
+                                                MOVE(9);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                p[1] = 0;
+                                                p[1] = 1;
+                                        }
+                                }
+                                p[0] = 1;
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MOVE(-1);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-8);
+                                }
+                                MOVE(8);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(-7);
+                        MULADD(1, 1);
+                        MULADD(4, -1);
+                        p[0] = 0;
+                        ADD(9, 26);
+                        MOVE(11);
+                        MULADD(-4, 1);
+                        p[0] = 0;
+                        MOVE(-4);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                ADD(4, 1);
+                                p[2] = 0;
+                        }
+                        MOVE(2);
+                        while (p[0]) {
+                                REACH(-7);
+                                ADD(-7, 1);
+                                MOVE(-8);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        ADD(3, 1);
+                                        p[1] = 0;
+                                        MOVE(1);
+                                }
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MOVE(-2);
+                                        MULADD(1, 1);
+                                        MULADD(4, -1);
+                                        p[0] = 0;
+                                        MOVE(3);
+                                }
+                                MOVE(13);
+                                while (p[0]) {
+                                        p[2] = 0;
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                p[3] = 0;
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(5);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        MULADD(1, 1);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(2);
+                                        MULADD(-9, 1);
+                                        p[0] = 0;
+                                        MOVE(7);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, 15);
+                                MOVE(9);
+                                while (p[0]) {
+                                        while (p[0])
+                                                MOVE(9);
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        p[5] = 0;
+                                        p[6] = 0;
+                                        p[7] = 0;
+                                        p[8] = 0;
+                                        p[9] = 0;
+                                        while (p[0])
+                                                MOVE(-9);
+                                        ADD(9, -1);
+                                        MOVE(9);
+                                }
+                                p[0] = 1;
+                                while (p[0]) {
+                                        ADD(1, 1);
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, -1);
+                                        MOVE(6);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-5);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(5, 1);
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(2);
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(2, 1);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        p[0] = 1;
+                                                        MOVE(9);
+                                                }
+                                                MOVE(-8);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                        }
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                MULADD(9, 1);
+                                                p[0] = 0;
+                                                MOVE(-10);
+                                        }
+                                        MOVE(1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        p[-1] = 1;
+                                        MOVE(7);
+                                }
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-3);
+                                                ADD(-3, 1);
+                                                MOVE(-2);
+                                                MULADD(-7, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(6);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-5);
+                                        MULADD(1, 1);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, 1);
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, -1);
+                                        MOVE(6);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-5);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(5, 1);
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(2);
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(2, 1);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        p[0] = 1;
+                                                        MOVE(9);
+                                                }
+                                                MOVE(-8);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                        }
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                MULADD(9, 1);
+                                                p[0] = 0;
+                                                MOVE(-10);
+                                        }
+                                        MOVE(1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        p[-1] = 1;
+                                        MOVE(7);
+                                }
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-4);
+                                                ADD(-4, 1);
+                                                MOVE(-3);
+                                                MULADD(-6, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                        }
+                                        MOVE(-3);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(4);
+                                        MULADD(-36, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(3);
+                                        MULADD(-36, 1);
+                                        p[0] = 0;
+                                        MOVE(6);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, 15);
+                                MOVE(9);
+                                while (p[0]) {
+                                        while (p[0])
+                                                MOVE(9);
+                                        REACH(-9);
+                                        ADD(-9, -1);
+                                        MOVE(-18);
+                                        while (p[0])
+                                                MOVE(-9);
+                                        ADD(9, -1);
+                                        MOVE(9);
+                                }
+                                p[0] = 1;
+                                while (p[0]) {
+                                        MOVE(8);
+                                        MULADD(-7, 1);
+                                        p[0] = 0;
+                                        MOVE(-7);
+                                        MULADD(1, 1);
+                                        MULADD(7, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        p[6] = 0;
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(4, 1);
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, -1);
+                                p[0] = 0;
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MOVE(-6);
+                                        MULADD(4, 2);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, -1);
+                                        p[0] = 1;
+                                        MOVE(1);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(-5);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                p[6] = 0;
+                                p[0] = 1;
+                                MOVE(4);
+                                MULADD(-4, -1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, -1);
+                                        MOVE(9);
+                                        while (p[0]) {
+                                                MOVE(2);
+                                                MULADD(-2, -1);
+                                                p[0] = 0;
+                                                p[0] = 1;
+                                                MOVE(-2);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(2, -1);
+                                                        MOVE(3);
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-3);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(3, 1);
+                                                                MOVE(-9);
+                                                                while (p[0])
+                                                                        MOVE(-9);
+                                                                p[3] = 0;
+                                                                p[3] = 1;
+                                                                MOVE(9);
+                                                                while (p[0])
+                                                                        MOVE(9);
+                                                                ADD(1, 1);
+                                                        }
+                                                }
+                                                p[0] = 1;
+                                                MOVE(3);
+                                                MULADD(-3, -1);
+                                                p[0] = 0;
+                                                p[0] = 1;
+                                                MOVE(-3);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(3, -1);
+                                                        MOVE(2);
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(2, 1);
+                                                                MOVE(-9);
+                                                                while (p[0])
+                                                                        MOVE(-9);
+                                                                p[4] = 0;
+                                                                p[4] = 1;
+                                                                MOVE(9);
+                                                                while (p[0])
+                                                                        MOVE(9);
+                                                                p[1] = 0;
+                                                                p[1] = 1;
+                                                        }
+                                                }
+                                                p[0] = 1;
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(-1);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        MOVE(-8);
+                                                }
+                                                MOVE(8);
+                                        }
+                                        MOVE(-9);
+                                        while (p[0])
+                                                MOVE(-9);
+                                        MOVE(4);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, 1);
+                                                MOVE(9);
+                                                while (p[0]) {
+                                                        ADD(1, 1);
+                                                        MOVE(3);
+                                                        MULADD(-2, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(8);
+                                                }
+                                                REACH(-8);
+                                                ADD(-8, 1);
+                                                MOVE(-9);
+                                                while (p[0]) {
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(5, 1);
+                                                                MOVE(1);
+                                                                while (p[0]) {
+                                                                        ADD(0, -1);
+                                                                        ADD(4, -1);
+                                                                        REACH(-10);
+                                                                        ADD(-10, 1);
+                                                                        MOVE(1);
+                                                                        MULADD(3, 1);
+                                                                        p[0] = 0;
+                                                                        MOVE(-1);
+                                                                }
+                                                                MOVE(1);
+                                                                MULADD(-11, 1);
+                                                                MULADD(3, -1);
+                                                                p[0] = 0;
+                                                                MOVE(-2);
+                                                        }
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(4, 1);
+                                                                MOVE(1);
+                                                                MULADD(-11, 1);
+                                                                MULADD(3, -1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(1);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-12);
+                                                }
+                                                p[4] = 0;
+                                        }
+                                        MOVE(3);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(3, 1);
+                                                MOVE(9);
+                                                while (p[0]) {
+                                                        ADD(1, 1);
+                                                        MOVE(2);
+                                                        MULADD(-1, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-1);
+                                                        MULADD(1, 1);
+                                                        p[0] = 0;
+                                                        MOVE(8);
+                                                }
+                                                REACH(-8);
+                                                ADD(-8, 1);
+                                                MOVE(-9);
+                                                while (p[0]) {
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(5, 1);
+                                                                MOVE(2);
+                                                                while (p[0]) {
+                                                                        ADD(0, -1);
+                                                                        ADD(3, -1);
+                                                                        REACH(-11);
+                                                                        ADD(-11, 1);
+                                                                        MOVE(-1);
+                                                                        MULADD(4, 1);
+                                                                        p[0] = 0;
+                                                                        MOVE(1);
+                                                                }
+                                                                MOVE(-1);
+                                                                MULADD(-10, 1);
+                                                                MULADD(4, -1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(2);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(3, 1);
+                                                                MOVE(-1);
+                                                                MULADD(-10, 1);
+                                                                MULADD(4, -1);
+                                                                p[0] = 0;
+                                                                MOVE(1);
+                                                        }
+                                                        MOVE(-1);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-11);
+                                                }
+                                                ADD(6, 1);
+                                        }
+                                }
+                                MOVE(4);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, 1);
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(5, 1);
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(4, -1);
+                                                                REACH(-10);
+                                                                ADD(-10, 1);
+                                                                MOVE(1);
+                                                                MULADD(3, 1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(1);
+                                                        MULADD(-11, 1);
+                                                        MULADD(3, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                }
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(4, 1);
+                                                        MOVE(1);
+                                                        MULADD(-11, 1);
+                                                        MULADD(3, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(1);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(-12);
+                                        }
+                                }
+                                p[1] = 0;
+                                p[3] = 0;
+                                p[4] = 0;
+                                MOVE(9);
+                                while (p[0]) {
+                                        p[2] = 0;
+                                        p[3] = 0;
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(5);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        MULADD(1, 1);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, 15);
+                                MOVE(9);
+                                while (p[0]) {
+                                        while (p[0])
+                                                MOVE(9);
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        p[5] = 0;
+                                        p[6] = 0;
+                                        p[7] = 0;
+                                        p[8] = 0;
+                                        p[9] = 0;
+                                        while (p[0])
+                                                MOVE(-9);
+                                        ADD(9, -1);
+                                        MOVE(9);
+                                }
+                                p[0] = 1;
+                                while (p[0]) {
+                                        ADD(1, 1);
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, -1);
+                                        MOVE(5);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, 1);
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(2);
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(2, 1);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        p[0] = 1;
+                                                        MOVE(9);
+                                                }
+                                                MOVE(-8);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                        }
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                MULADD(9, 1);
+                                                p[0] = 0;
+                                                MOVE(-10);
+                                        }
+                                        MOVE(1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        p[-1] = 1;
+                                        MOVE(7);
+                                }
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-3);
+                                                ADD(-3, 1);
+                                                MOVE(-2);
+                                                MULADD(-7, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(3);
+                                        }
+                                        MOVE(-2);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(3);
+                                        MULADD(-36, 1);
+                                        p[0] = 0;
+                                        MOVE(6);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                p[5] = 0;
+                                ADD(9, 15);
+                                MOVE(9);
+                                while (p[0]) {
+                                        while (p[0])
+                                                MOVE(9);
+                                        REACH(-9);
+                                        ADD(-9, -1);
+                                        MOVE(-18);
+                                        while (p[0])
+                                                MOVE(-9);
+                                        ADD(9, -1);
+                                        MOVE(9);
+                                }
+                                p[0] = 1;
+                                while (p[0]) {
+                                        MOVE(3);
+                                        MULADD(-3, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(3, -1);
+                                                MOVE(4);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(4, 1);
+                                                        MOVE(-9);
+                                                        while (p[0])
+                                                                MOVE(-9);
+                                                        p[4] = 0;
+                                                        p[4] = 1;
+                                                        MOVE(9);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        ADD(1, 1);
+                                                }
+                                        }
+                                        p[0] = 1;
+                                        MOVE(4);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, -1);
+                                                MOVE(3);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-3);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(3, 1);
+                                                        MOVE(-9);
+                                                        while (p[0])
+                                                                MOVE(-9);
+                                                        p[3] = 0;
+                                                        p[3] = 1;
+                                                        MOVE(9);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        p[1] = 0;
+                                                        p[1] = 1;
+                                                }
+                                        }
+                                        p[0] = 1;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                MOVE(-1);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                MOVE(-8);
+                                        }
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(3);
+                                MULADD(-3, 1);
+                                p[0] = 0;
+                                MOVE(-3);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(3, 1);
+                                        MOVE(9);
+                                        while (p[0]) {
+                                                ADD(1, 1);
+                                                MOVE(4);
+                                                MULADD(-3, -1);
+                                                p[0] = 0;
+                                                MOVE(-3);
+                                                MULADD(3, 1);
+                                                p[0] = 0;
+                                                MOVE(8);
+                                        }
+                                        REACH(-8);
+                                        ADD(-8, 1);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(1, 1);
+                                                        MOVE(2);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                REACH(-1);
+                                                                ADD(-1, -1);
+                                                                REACH(-11);
+                                                                ADD(-11, 1);
+                                                                MOVE(1);
+                                                                MULADD(-2, 1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(1);
+                                                        MULADD(-12, 1);
+                                                        MULADD(-2, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-3);
+                                                }
+                                                MOVE(2);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        REACH(-1);
+                                                        ADD(-1, 1);
+                                                        MOVE(1);
+                                                        MULADD(-12, 1);
+                                                        MULADD(-2, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(1);
+                                                MULADD(-2, 1);
+                                                p[0] = 0;
+                                                MOVE(-13);
+                                        }
+                                }
+                                MOVE(4);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, 1);
+                                        MOVE(9);
+                                        while (p[0]) {
+                                                ADD(1, 1);
+                                                MOVE(3);
+                                                MULADD(-2, -1);
+                                                p[0] = 0;
+                                                MOVE(-2);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(8);
+                                        }
+                                        REACH(-8);
+                                        ADD(-8, 1);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(1, 1);
+                                                        MOVE(3);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                REACH(-2);
+                                                                ADD(-2, -1);
+                                                                REACH(-12);
+                                                                ADD(-12, 1);
+                                                                MOVE(-1);
+                                                                MULADD(-1, 1);
+                                                                p[0] = 0;
+                                                                MOVE(1);
+                                                        }
+                                                        MOVE(-1);
+                                                        MULADD(-11, 1);
+                                                        MULADD(-1, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                }
+                                                MOVE(3);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        REACH(-2);
+                                                        ADD(-2, 1);
+                                                        MOVE(-1);
+                                                        MULADD(-11, 1);
+                                                        MULADD(-1, -1);
+                                                        p[0] = 0;
+                                                        MOVE(1);
+                                                }
+                                                MOVE(-1);
+                                                MULADD(-1, 1);
+                                                p[0] = 0;
+                                                MOVE(-12);
+                                        }
+                                        ADD(5, 1);
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        p[5] = 0;
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                p[3] = 0;
+                                p[4] = 0;
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(7);
+                                        MULADD(-6, 1);
+                                        p[0] = 0;
+                                        MOVE(-6);
+                                        MULADD(2, 1);
+                                        MULADD(6, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(4, 1);
+                                MOVE(5);
+                                MULADD(-5, 1);
+                                MULADD(-1, -1);
+                                p[0] = 0;
+                                MOVE(2);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MOVE(-7);
+                                        MULADD(4, 2);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, -1);
+                                        p[0] = 1;
+                                        MOVE(2);
+                                }
+                                MOVE(-2);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(-5);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(4);
+                                MULADD(-4, -1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, -1);
+                                        MOVE(9);
+                                        while (p[0]) {
+                                                MOVE(3);
+                                                MULADD(-3, -1);
+                                                p[0] = 0;
+                                                p[0] = 1;
+                                                MOVE(-3);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(3, -1);
+                                                        MOVE(2);
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(2, 1);
+                                                                MOVE(-9);
+                                                                while (p[0])
+                                                                        MOVE(-9);
+                                                                p[4] = 0;
+                                                                p[4] = 1;
+                                                                MOVE(9);
+                                                                while (p[0])
+                                                                        MOVE(9);
+                                                                ADD(1, 1);
+                                                        }
+                                                }
+                                                p[0] = 1;
+                                                MOVE(2);
+                                                MULADD(-2, -1);
+                                                p[0] = 0;
+                                                p[0] = 1;
+                                                MOVE(-2);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(2, -1);
+                                                        MOVE(3);
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-3);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(3, 1);
+                                                                MOVE(-9);
+                                                                while (p[0])
+                                                                        MOVE(-9);
+                                                                p[3] = 0;
+                                                                p[3] = 1;
+                                                                MOVE(9);
+                                                                while (p[0])
+                                                                        MOVE(9);
+                                                                p[1] = 0;
+                                                                p[1] = 1;
+                                                        }
+                                                }
+                                                p[0] = 1;
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(-1);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        MOVE(-8);
+                                                }
+                                                MOVE(8);
+                                        }
+                                        MOVE(-9);
+                                        while (p[0])
+                                                MOVE(-9);
+                                        MOVE(3);
+                                        MULADD(-3, 1);
+                                        p[0] = 0;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(3, 1);
+                                                MOVE(9);
+                                                while (p[0]) {
+                                                        ADD(1, 1);
+                                                        MOVE(2);
+                                                        MULADD(-1, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-1);
+                                                        MULADD(1, 1);
+                                                        p[0] = 0;
+                                                        MOVE(8);
+                                                }
+                                                REACH(-8);
+                                                ADD(-8, 1);
+                                                MOVE(-9);
+                                                while (p[0]) {
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(4, 1);
+                                                                MOVE(2);
+                                                                while (p[0]) {
+                                                                        ADD(0, -1);
+                                                                        ADD(2, -1);
+                                                                        REACH(-11);
+                                                                        ADD(-11, 1);
+                                                                        MOVE(-1);
+                                                                        MULADD(3, 1);
+                                                                        p[0] = 0;
+                                                                        MOVE(1);
+                                                                }
+                                                                MOVE(-1);
+                                                                MULADD(-10, 1);
+                                                                MULADD(3, -1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(2);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(2, 1);
+                                                                MOVE(-1);
+                                                                MULADD(-10, 1);
+                                                                MULADD(3, -1);
+                                                                p[0] = 0;
+                                                                MOVE(1);
+                                                        }
+                                                        MOVE(-1);
+                                                        MULADD(3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-11);
+                                                }
+                                                p[5] = 0;
+                                                MOVE(7);
+                                                MULADD(-7, 1);
+                                                p[0] = 0;
+                                                MOVE(-7);
+                                                MULADD(5, 1);
+                                                MULADD(7, 1);
+                                                p[0] = 0;
+                                        }
+                                        MOVE(4);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, 1);
+                                                MOVE(9);
+                                                while (p[0]) {
+                                                        ADD(1, 1);
+                                                        MOVE(3);
+                                                        MULADD(-2, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(8);
+                                                }
+                                                REACH(-8);
+                                                ADD(-8, 1);
+                                                MOVE(-9);
+                                                while (p[0]) {
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(4, 1);
+                                                                MOVE(1);
+                                                                while (p[0]) {
+                                                                        ADD(0, -1);
+                                                                        ADD(3, -1);
+                                                                        REACH(-10);
+                                                                        ADD(-10, 1);
+                                                                        MOVE(1);
+                                                                        MULADD(2, 1);
+                                                                        p[0] = 0;
+                                                                        MOVE(-1);
+                                                                }
+                                                                MOVE(1);
+                                                                MULADD(-11, 1);
+                                                                MULADD(2, -1);
+                                                                p[0] = 0;
+                                                                MOVE(-2);
+                                                        }
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(3, 1);
+                                                                MOVE(1);
+                                                                MULADD(-11, 1);
+                                                                MULADD(2, -1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(1);
+                                                        MULADD(2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-12);
+                                                }
+                                        }
+                                        p[4] = 0;
+                                }
+                                MOVE(4);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, 1);
+                                        p[5] = 0;
+                                        MOVE(7);
+                                        MULADD(-7, 1);
+                                        p[0] = 0;
+                                        MOVE(-7);
+                                        MULADD(5, 1);
+                                        MULADD(7, 1);
+                                        p[0] = 0;
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(4, 1);
+                                                        MOVE(1);
+                                                        while (p[0]) {
+                                                                ADD(0, -1);
+                                                                ADD(3, -1);
+                                                                REACH(-10);
+                                                                ADD(-10, 1);
+                                                                MOVE(1);
+                                                                MULADD(2, 1);
+                                                                p[0] = 0;
+                                                                MOVE(-1);
+                                                        }
+                                                        MOVE(1);
+                                                        MULADD(-11, 1);
+                                                        MULADD(2, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                }
+                                                MOVE(1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(3, 1);
+                                                        MOVE(1);
+                                                        MULADD(-11, 1);
+                                                        MULADD(2, -1);
+                                                        p[0] = 0;
+                                                        MOVE(-1);
+                                                }
+                                                MOVE(1);
+                                                MULADD(2, 1);
+                                                p[0] = 0;
+                                                MOVE(-12);
+                                        }
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        p[2] = 0;
+                                        p[3] = 0;
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                p[3] = 0;
+                                p[4] = 0;
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(5);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        MULADD(1, 1);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(6);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-5);
+                                        MULADD(2, 1);
+                                        MULADD(5, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, 15);
+                                MOVE(9);
+                                while (p[0]) {
+                                        while (p[0])
+                                                MOVE(9);
+                                        p[0] = 1;
+                                        p[1] = 0;
+                                        p[2] = 0;
+                                        p[3] = 0;
+                                        p[4] = 0;
+                                        p[5] = 0;
+                                        p[6] = 0;
+                                        p[7] = 0;
+                                        p[8] = 0;
+                                        p[9] = 0;
+                                        while (p[0])
+                                                MOVE(-9);
+                                        ADD(9, -1);
+                                        MOVE(9);
+                                }
+                                p[0] = 1;
+                                while (p[0]) {
+                                        ADD(1, 1);
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, -1);
+                                        MOVE(5);
+                                        MULADD(-4, 1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, 1);
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(2);
+                                                        MULADD(-2, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-2);
+                                                        MULADD(2, 1);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        p[0] = 1;
+                                                        MOVE(9);
+                                                }
+                                                MOVE(-8);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                        }
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(1);
+                                                MULADD(9, 1);
+                                                p[0] = 0;
+                                                MOVE(-10);
+                                        }
+                                        MOVE(1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        p[-1] = 1;
+                                        MOVE(7);
+                                }
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-4);
+                                                ADD(-4, 1);
+                                                MOVE(-3);
+                                                MULADD(-6, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                        }
+                                        MOVE(-3);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, 1);
+                                        MOVE(9);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, -1);
+                                        MOVE(6);
+                                        MULADD(-5, 1);
+                                        p[0] = 0;
+                                        MOVE(-5);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(5, 1);
+                                                MOVE(-1);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        MOVE(3);
+                                                        MULADD(-3, 1);
+                                                        p[0] = 0;
+                                                        MOVE(-3);
+                                                        MULADD(3, 1);
+                                                        MULADD(4, 1);
+                                                        p[0] = 0;
+                                                        p[0] = 1;
+                                                        MOVE(9);
+                                                }
+                                                MOVE(-8);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                        }
+                                        MOVE(9);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-9);
+                                        while (p[0]) {
+                                                MOVE(2);
+                                                MULADD(9, 1);
+                                                p[0] = 0;
+                                                MOVE(-11);
+                                        }
+                                        MOVE(2);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        REACH(-2);
+                                        p[-2] = 1;
+                                        MOVE(6);
+                                }
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-4);
+                                                ADD(-4, 1);
+                                                MOVE(-3);
+                                                MULADD(-6, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(4);
+                                        }
+                                        MOVE(-3);
+                                        MULADD(3, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(4);
+                                        MULADD(-36, 1);
+                                        p[0] = 0;
+                                        MOVE(5);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(9, 15);
+                                MOVE(9);
+                                while (p[0]) {
+                                        while (p[0])
+                                                MOVE(9);
+                                        REACH(-9);
+                                        ADD(-9, -1);
+                                        MOVE(-18);
+                                        while (p[0])
+                                                MOVE(-9);
+                                        ADD(9, -1);
+                                        MOVE(9);
+                                }
+                                p[0] = 1;
+                                ADD(21, 1);
+                                MOVE(18);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(3);
+                                        MULADD(-3, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        MOVE(-3);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(3, -1);
+                                                MOVE(4);
+                                                MULADD(-4, 1);
+                                                p[0] = 0;
+                                                MOVE(-4);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(4, 1);
+                                                        MOVE(-9);
+                                                        while (p[0])
+                                                                MOVE(-9);
+                                                        p[4] = 0;
+                                                        p[4] = 1;
+                                                        MOVE(9);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        ADD(1, 1);
+                                                }
+                                        }
+                                        p[0] = 1;
+                                        MOVE(4);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        MOVE(-4);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(4, -1);
+                                                MOVE(3);
+                                                MULADD(-3, 1);
+                                                p[0] = 0;
+                                                MOVE(-3);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(3, 1);
+                                                        MOVE(-9);
+                                                        while (p[0])
+                                                                MOVE(-9);
+                                                        p[3] = 0;
+                                                        p[3] = 1;
+                                                        MOVE(9);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        p[1] = 0;
+                                                        p[1] = 1;
+                                                }
+                                        }
+                                        p[0] = 1;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                MOVE(-1);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                MOVE(-8);
+                                        }
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                ADD(2, -1);
+                                MOVE(4);
+                                MULADD(-4, 1);
+                                p[0] = 0;
+                                MOVE(-4);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(4, 1);
+                                        p[2] = 0;
+                                }
+                                MOVE(2);
+                        }
+                        REACH(-2);
+                        ADD(-2, 1);
+                        MOVE(2);
+                        MULADD(-4, -1);
+                        p[0] = 0;
+                        p[0] = 1;
+                        MOVE(-4);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                ADD(4, -1);
+                                REACH(-2);
+                                put(p[-2], 1);
+                        }
+                        MOVE(4);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                REACH(-7);
+                                put(p[-7], 1);
+                        }
+                        REACH(-3);
+                        p[-3] = 0;
+                        p[-2] = 0;
+                        p[-1] = 0;
+                        p[1] = 0;
+                        p[2] = 0;
+                        MOVE(5);
+                        while (p[0]) {
+                                p[1] = 0;
+                                p[2] = 0;
+                                p[3] = 0;
+                                p[4] = 0;
+                                p[5] = 0;
+                                p[6] = 0;
+                                MOVE(9);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(9);
+                        while (p[0]) {
+                                p[5] = 0;
+                                MOVE(9);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        ADD(1, 11);
+                        MOVE(1);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                MULADD(9, 1);
+                                p[0] = 0;
+                                MOVE(9);
+                        }
+                        ADD(4, 1);
+                        ADD(13, 1);
+                        MOVE(-1);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(7);
+                        MULADD(-7, 1);
+                        p[0] = 0;
+                        MOVE(-7);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                ADD(7, 1);
+                                p[7] = 0;
+                                MOVE(9);
+                                while (p[0])
+                                        MOVE(9);
+                                MOVE(-9);
+                                while (p[0]) {
+                                        MOVE(7);
+                                        MULADD(-6, 1);
+                                        p[0] = 0;
+                                        MOVE(-6);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(6, 1);
+                                                MOVE(-1);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                                p[7] = 0;
+                                                p[7] = 1;
+                                                MOVE(10);
+                                        }
+                                        MOVE(-10);
+                                }
+                        }
+                        MOVE(7);
+                        MULADD(-7, 1);
+                        p[0] = 0;
+                        MOVE(-7);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                ADD(7, 1);
+                                MOVE(9);
+                                while (p[0]) {
+                                        ADD(1, 1);
+                                        MOVE(5);
+                                        MULADD(-4, -1);
+                                        p[0] = 0;
+                                        MOVE(-4);
+                                        MULADD(4, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                REACH(-2);
+                                ADD(-2, 1);
+                                MOVE(-9);
+                                while (p[0]) {
+                                        MOVE(5);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(-14);
+                                }
+                                MOVE(9);
+                                while (p[0])
+                                        MOVE(9);
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(7);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                                MOVE(-6);
+                                                MULADD(-3, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(7);
+                                        }
+                                        MOVE(-6);
+                                        MULADD(6, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                ADD(7, -1);
+                                p[3] = 0;
+                                p[3] = 1;
+                        }
+                        p[0] = 1;
+                        MOVE(7);
+                        MULADD(-7, -1);
+                        p[0] = 0;
+                        p[0] = 1;
+                        MOVE(-7);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                ADD(7, -1);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(5);
+                                        MULADD(2, 1);
+                                        p[0] = 0;
+                                        MOVE(4);
+                                }
+                                MOVE(-9);
+                                while (p[0]) {
+                                        p[1] = 0;
+                                        ADD(0, -1);
+                                        MOVE(7);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                REACH(-7);
+                                                ADD(-7, 1);
+                                                MOVE(-6);
+                                                MULADD(-3, 1);
+                                                MULADD(-1, -1);
+                                                p[0] = 0;
+                                                MOVE(-1);
+                                                MULADD(1, 1);
+                                                p[0] = 0;
+                                                MOVE(7);
+                                        }
+                                        MOVE(-6);
+                                        MULADD(6, 1);
+                                        p[0] = 0;
+                                        REACH(-1);
+                                        ADD(-1, 1);
+                                        MOVE(-10);
+                                }
+                                ADD(1, 5);
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(9);
+                                }
+                                ADD(4, 1);
+                                MOVE(-1);
+                                while (p[0])
+                                        MOVE(-9);
+                                MOVE(9);
+                                while (p[0]) {
+                                        MOVE(5);
+                                        MULADD(-5, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        MOVE(-5);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(5, -1);
+                                                MOVE(7);
+                                                MULADD(-7, 1);
+                                                p[0] = 0;
+                                                MOVE(-7);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(7, 1);
+                                                        MOVE(-9);
+                                                        while (p[0])
+                                                                MOVE(-9);
+                                                        p[4] = 0;
+                                                        p[4] = 1;
+                                                        MOVE(9);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        ADD(1, 1);
+                                                }
+                                        }
+                                        p[0] = 1;
+                                        MOVE(7);
+                                        MULADD(-7, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        MOVE(-7);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(7, -1);
+                                                MOVE(5);
+                                                MULADD(-5, 1);
+                                                p[0] = 0;
+                                                MOVE(-5);
+                                                while (p[0]) {
+                                                        ADD(0, -1);
+                                                        ADD(5, 1);
+                                                        MOVE(-9);
+                                                        while (p[0])
+                                                                MOVE(-9);
+                                                        p[3] = 0;
+                                                        p[3] = 1;
+                                                        MOVE(9);
+                                                        while (p[0])
+                                                                MOVE(9);
+                                                        p[1] = 0;
+                                                        p[1] = 1;
+                                                }
+                                        }
+                                        p[0] = 1;
+                                        MOVE(1);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                MOVE(-1);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                MOVE(-8);
+                                        }
+                                        MOVE(8);
+                                }
+                                MOVE(-9);
+                                while (p[0])
+                                        MOVE(-9);
+                                p[4] = 0;
+                                ADD(1, 5);
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MULADD(9, 1);
+                                        p[0] = 0;
+                                        MOVE(9);
+                                }
+                                ADD(4, -1);
+                                MOVE(-1);
+                                while (p[0])
+                                        MOVE(-9);
+                        }
+                        MOVE(3);
+                }
+                REACH(-4);
+                put(p[-4], 1);
+                MOVE(6);
+                while (p[0]) {
+                        p[6] = 0;
+                        MOVE(9);
+                }
+                MOVE(-9);
+                while (p[0])
+                        MOVE(-9);
+                ADD(1, 10);
+                MOVE(1);
+                while (p[0]) {
+                        ADD(0, -1);
+                        MULADD(9, 1);
+                        p[0] = 0;
+                        MOVE(9);
+                }
+                ADD(5, 1);
+                ADD(14, 1);
+                MOVE(-1);
+                while (p[0])
+                        MOVE(-9);
+                MOVE(8);
+                MULADD(-8, 1);
+                p[0] = 0;
+                MOVE(-8);
+                while (p[0]) {
+                        ADD(0, -1);
+                        ADD(8, 1);
+                        p[8] = 0;
+                        MOVE(9);
+                        while (p[0])
+                                MOVE(9);
+                        MOVE(-9);
+                        while (p[0]) {
+                                MOVE(8);
+                                MULADD(-7, 1);
+                                p[0] = 0;
+                                MOVE(-7);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(7, 1);
+                                        MOVE(-1);
+                                        while (p[0])
+                                                MOVE(-9);
+                                        p[8] = 0;
+                                        p[8] = 1;
+                                        MOVE(10);
+                                }
+                                MOVE(-10);
+                        }
+                }
+                MOVE(8);
+                MULADD(-8, 1);
+                p[0] = 0;
+                MOVE(-8);
+                while (p[0]) {
+                        ADD(0, -1);
+                        ADD(8, 1);
+                        MOVE(9);
+                        while (p[0]) {
+                                ADD(1, 1);
+                                MOVE(6);
+                                MULADD(-5, -1);
+                                p[0] = 0;
+                                MOVE(-5);
+                                MULADD(5, 1);
+                                p[0] = 0;
+                                MOVE(8);
+                        }
+                        REACH(-1);
+                        ADD(-1, 1);
+                        MOVE(-9);
+                        while (p[0]) {
+                                MOVE(6);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(-15);
+                        }
+                        MOVE(9);
+                        while (p[0])
+                                MOVE(9);
+                        MOVE(-9);
+                        while (p[0]) {
+                                p[1] = 0;
+                                ADD(0, -1);
+                                MOVE(8);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        REACH(-8);
+                                        ADD(-8, 1);
+                                        MOVE(-7);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, -1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-7);
+                                MULADD(7, 1);
+                                p[0] = 0;
+                                REACH(-1);
+                                ADD(-1, 1);
+                                MOVE(-10);
+                        }
+                        ADD(8, -1);
+                        p[3] = 0;
+                        p[3] = 1;
+                }
+                p[0] = 1;
+                MOVE(8);
+                MULADD(-8, -1);
+                p[0] = 0;
+                p[0] = 1;
+                MOVE(-8);
+                while (p[0]) {
+                        ADD(0, -1);
+                        ADD(8, -1);
+                        MOVE(9);
+                        while (p[0]) {
+                                MOVE(6);
+                                MULADD(2, 1);
+                                p[0] = 0;
+                                MOVE(3);
+                        }
+                        MOVE(-9);
+                        while (p[0]) {
+                                p[1] = 0;
+                                ADD(0, -1);
+                                MOVE(8);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        REACH(-8);
+                                        ADD(-8, 1);
+                                        MOVE(-7);
+                                        MULADD(-2, 1);
+                                        MULADD(-1, -1);
+                                        p[0] = 0;
+                                        MOVE(-1);
+                                        MULADD(1, 1);
+                                        p[0] = 0;
+                                        MOVE(8);
+                                }
+                                MOVE(-7);
+                                MULADD(7, 1);
+                                p[0] = 0;
+                                REACH(-1);
+                                ADD(-1, 1);
+                                MOVE(-10);
+                        }
+                        ADD(1, 5);
+                        MOVE(1);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                MULADD(9, 1);
+                                p[0] = 0;
+                                MOVE(9);
+                        }
+                        ADD(5, 1);
+                        ADD(32, 1);
+                        MOVE(26);
+                        while (p[0])
+                                MOVE(-9);
+                        MOVE(9);
+                        while (p[0]) {
+                                MOVE(6);
+                                MULADD(-6, -1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(-6);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(6, -1);
+                                        MOVE(8);
+                                        MULADD(-8, 1);
+                                        p[0] = 0;
+                                        MOVE(-8);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(8, 1);
+                                                MOVE(-9);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                                p[4] = 0;
+                                                p[4] = 1;
+                                                MOVE(9);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                ADD(1, 1);
+                                        }
+                                }
+                                p[0] = 1;
+                                MOVE(8);
+                                MULADD(-8, -1);
+                                p[0] = 0;
+                                p[0] = 1;
+                                MOVE(-8);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        ADD(8, -1);
+                                        MOVE(6);
+                                        MULADD(-6, 1);
+                                        p[0] = 0;
+                                        MOVE(-6);
+                                        while (p[0]) {
+                                                ADD(0, -1);
+                                                ADD(6, 1);
+                                                MOVE(-9);
+                                                while (p[0])
+                                                        MOVE(-9);
+                                                p[3] = 0;
+                                                p[3] = 1;
+                                                MOVE(9);
+                                                while (p[0])
+                                                        MOVE(9);
+                                                p[1] = 0;
+                                                p[1] = 1;
+                                        }
+                                }
+                                p[0] = 1;
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MOVE(-1);
+                                        while (p[0])
+                                                MOVE(9);
+                                        MOVE(-8);
+                                }
+                                MOVE(8);
+                        }
+                        MOVE(-9);
+                        while (p[0])
+                                MOVE(-9);
+                        p[4] = 0;
+                        ADD(1, 5);
+                        MOVE(1);
+                        while (p[0]) {
+                                ADD(0, -1);
+                                MULADD(9, 1);
+                                p[0] = 0;
+                                MOVE(9);
+                        }
+                        ADD(5, -1);
+                        ADD(32, -1);
+                        MOVE(26);
+                        while (p[0])
+                                MOVE(-9);
+                }
+                MOVE(3);
+        }
+
+        flush_output();
+        return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/* Generated by bf. */
+typedef unsigned char cell_t;
+typedef unsigned char ucell_t;
+
+#define LOWEST  -2
+#define HIGHEST 7
+
+#define FLUSH_LINES  0
+#define FLUSH_INPUT  1
+#define END_OF_INPUT -1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static cell_t* tape;
+static size_t  tape_size = 65536 - LOWEST;
+static cell_t* low;
+static cell_t* high;
+
+static unsigned char output[1 << 16];
+static size_t        output_used;
+
+static void flush_output(void)
+{
+        fwrite(output, 1, output_used, stdout);
+        fflush(stdout);
+        output_used = 0;
+}
+
+static void put(cell_t value, unsigned int count)
+{
+        while (count--) {
+                if (output_used == sizeof output)
+                        flush_output();
+                output[output_used++] = (unsigned char)value;
+                if (FLUSH_LINES && (unsigned char)value == '\n')
+                        flush_output();
+        }
+}
+
+static void bind(void)
+{
+        low  = tape - LOWEST;      /* cells left of it are padding for negative offsets */
+        high = tape + tape_size - HIGHEST;
+}
+
+static cell_t* check(cell_t* p)
+{
+        size_t position;
+
+        if (p < low) {
+                flush_output();
+                fputs("Error: pc underflow\n", stderr);
+                exit(EXIT_FAILURE);
+        }
+
+        position = p - tape;
+
+        if (p >= high) {
+                size_t size = position + HIGHEST + 1000;
+
+                if (!(tape = realloc(tape, size * sizeof *tape))) {
+                        fputs("Error: out of memory\n", stderr);
+                        exit(EXIT_FAILURE);
+                }
+
+                memset(tape + tape_size, 0, (size - tape_size) * sizeof *tape);
+                tape_size = size;
+                bind();
+        }
+
+        return tape + position;
+}
+
+#define ADD(k, n)     p[k] = (cell_t)((ucell_t)p[k] + (ucell_t)(n))
+#define MULADD(k, n)  p[k] = (cell_t)(ucell_t)((unsigned long long)(ucell_t)p[k] + (unsigned long long)(ucell_t)p[0] * (ucell_t)(n))
+#define MOVE(n)       do { p += (n); if (p < low || p >= high) p = check(p); } while (0)
+#define REACH(k)      do { if (p + (k) < low) check(p + (k)); } while (0)
+
+int main(void)
+{
+        cell_t* p;
+
+        tape = calloc(tape_size, sizeof *tape);
+        bind();
+        p = check(tape - LOWEST);
+
+        {
+                static const ucell_t image[] = {
+                        101ull, 1ull,
+                };
+
+                p = check(p + sizeof image / sizeof *image) - sizeof image / sizeof *image;
+                memcpy(p, image, sizeof image);
+        }
+
+        while (p[0]) {
+                MOVE(1);
+                MULADD(1, 1);
+                MULADD(2, 1);
+                p[0] = 0;
+                p[0] = 2;
+                MOVE(2);
+                MULADD(-2, 1);
+                p[0] = 0;
+                p[3] = 0;
+                p[3] = 2;
+                p[4] = 0;
+                p[4] = 1;
+                ADD(7, 1);
+                MOVE(7);
+                while (p[0]) {
+                        p[0] = 0;
+                        p[0] = 6;
+                        MOVE(3);
+                }
+                MOVE(-3);
+                while (p[0]) {
+                        MULADD(-2, 2);
+                        MULADD(-1, 8);
+                        p[0] = 0;
+                        p[0] = 1;
+                        REACH(-1);
+                        put(p[-1], 1);
+                        MOVE(-2);
+                        MULADD(1, -4);
+                        p[0] = 0;
+                        MOVE(-1);
+                }
+                MOVE(-2);
+                while (p[0]) {
+                        MOVE(5);
+                        while (p[0]) {
+                                p[3] = 0;
+                                p[3] = 9;
+                                MOVE(2);
+                                MULADD(1, -1);
+                                p[0] = 0;
+                                p[0] = 9;
+                                MOVE(1);
+                                while (p[0]) {
+                                        ADD(0, -1);
+                                        MULADD(-1, -1);
+                                        p[0] = 0;
+                                        p[0] = 1;
+                                        while (p[0])
+                                                MOVE(-3);
+                                }
+                                MOVE(-1);
+                                MULADD(1, 1);
+                                p[0] = 0;
+                                MOVE(1);
+                        }
+                        REACH(-2);
+                        ADD(-2, -1);
+                        MOVE(-2);
+                }
+                REACH(-2);
+                ADD(-2, -1);
+                MOVE(-2);
+        }
+
+        flush_output();
+        return EXIT_SUCCESS;
+}
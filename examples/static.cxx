@@ -0,0 +1,78 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+//! A program built into the binary with bf_static.h, run on standard input under the
+//  overflow policy named on the command line. make check-static compares what it
+//  does with bin/bf running the source it prints with --source.
+
+#include "bf_static.h"
+#include "bf_evaluate.h"
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+namespace {
+
+//! Counts 8 down by every byte read and writes the result, so checked cells go past
+//  their limits on bytes over 8.
+constexpr char countdown[] = ",[>++++++++<[->-<]>.[-]<,]";
+
+template<typename P> int run()
+{
+        bf::static_program_t<countdown, unsigned char, P> program(bf::FLUSH_Block, bf::EOF_Zero);
+
+        try {
+                program.run();
+        }
+        catch (bf::error_t& e) {
+                return detail::display_error_cause(e.what(), countdown, sizeof countdown - 1, e.commands);
+        }
+
+        return EXIT_SUCCESS;
+}
+
+int usage()
+{
+        std::cout<<"Usage: static --source | wrap | trap | saturate"<<std::endl;
+        return EXIT_FAILURE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+        if (argc != 2)
+                return usage();
+
+        if (!strcmp(argv[1], "--source")) {
+                std::cout<<countdown<<std::endl;
+                return EXIT_SUCCESS;
+        }
+
+        if (!strcmp(argv[1], "wrap"))
+                return run<bf::wrap_policy_t>();
+
+        if (!strcmp(argv[1], "trap"))
+                return run<bf::trap_policy_t>();
+
+        if (!strcmp(argv[1], "saturate"))
+                return run<bf::saturate_policy_t>();
+
+        return usage();
+}
@@ -0,0 +1,444 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_BATCH
+#define _H_BF_BATCH
+
+#include "bf_program.h"
+#include "bf_cache.h"
+#include "bf_evaluate.h"
+#include "bf_lanes.h"
+#include "bf_reader.h"
+#include "bf_io.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <cstdlib>
+
+namespace detail {
+
+//! What runs the jobs of a batch.
+enum batch_engine_t {
+        BATCH_Tiered
+      , BATCH_Threaded
+      , BATCH_Lanes                          // the jobs of a program in groups, in lockstep
+};
+
+//! A line of the manifest - run a program over an input file into an output file.
+struct batch_job_t {
+        unsigned int line;
+        std::size_t program;                   // index of the program among the distinct ones
+        std::string input;                     // "-" for none
+        std::string output;
+};
+
+//! Reads a manifest: one job per line, its program, input and output separated by
+//  whitespace. Empty lines and lines starting with '#' are skipped. Each distinct
+//  program path is listed once in programs.
+inline void parse_manifest(const char* manifest, size_t manifest_size, std::vector<batch_job_t>& jobs, std::vector<std::string>& programs)
+{
+        std::istringstream in(std::string(manifest, manifest_size));
+        std::map<std::string, std::size_t> seen;
+        std::string text;
+        unsigned int line = 0;
+
+        while (std::getline(in, text)) {
+                std::istringstream fields(text);
+                std::string program, extra;
+                batch_job_t job;
+
+                job.line = ++line;
+
+                if (!(fields>>program) || program[0] == '#')
+                        continue;
+
+                if (!(fields>>job.input>>job.output) || fields>>extra) {
+                        std::ostringstream message;
+
+                        message<<"manifest line "<<line<<": expected a program, an input and an output";
+                        throw std::runtime_error(message.str());
+                }
+
+                std::map<std::string, std::size_t>::iterator known = seen.find(program);
+
+                if (known == seen.end()) {
+                        known = seen.insert(std::make_pair(program, programs.size())).first;
+                        programs.push_back(program);
+                }
+
+                job.program = known->second;
+                jobs.push_back(job);
+        }
+}
+
+//! Work stealing over the tasks 0 .. count - 1. Each worker starts with an even share
+//  and takes from the front of it, a worker that runs out steals from the back of
+//  another's share.
+struct work_queues_t {
+        work_queues_t(std::size_t workers, std::size_t count);
+
+        bool next(std::size_t worker, std::size_t& task);
+
+private:
+        struct queue_t {
+                std::mutex lock;
+                std::deque<std::size_t> tasks;
+        };
+
+        std::vector<std::unique_ptr<queue_t> > queues_;
+};
+
+inline work_queues_t::work_queues_t(std::size_t workers, std::size_t count)
+{
+        for (std::size_t i = 0; i != workers; ++i) {
+                queues_.push_back(std::unique_ptr<queue_t>(new queue_t));
+
+                for (std::size_t task = count * i / workers; task != count * (i + 1) / workers; ++task)
+                        queues_.back()->tasks.push_back(task);
+        }
+}
+
+inline bool work_queues_t::next(std::size_t worker, std::size_t& task)
+{
+        for (std::size_t i = 0; i != queues_.size(); ++i) {
+                queue_t& queue = *queues_[(worker + i) % queues_.size()];
+                std::lock_guard<std::mutex> hold(queue.lock);
+
+                if (queue.tasks.empty())
+                        continue;
+
+                if (i == 0) {
+                        task = queue.tasks.front();
+                        queue.tasks.pop_front();
+                }
+                else {
+                        task = queue.tasks.back();
+                        queue.tasks.pop_back();
+                }
+
+                return true;
+        }
+
+        return false;
+}
+
+//! Runs task(worker, index) for every index below count on as many threads as there
+//  are workers, the calling thread being one of them.
+template<typename F> void run_workers(std::size_t workers, std::size_t count, F task)
+{
+        work_queues_t queues(workers, count);
+        std::vector<std::thread> threads;
+
+        for (std::size_t worker = 0; worker != workers; ++worker) {
+                auto work = [&queues, &task, worker]() {
+                        std::size_t index;
+
+                        while (queues.next(worker, index))
+                                task(worker, index);
+                };
+
+                if (worker + 1 == workers)
+                        work();
+                else
+                        threads.push_back(std::thread(work));
+        }
+
+        for (std::size_t i = 0; i != threads.size(); ++i)
+                threads[i].join();
+}
+
+//! A program compiled once for all of its jobs. error is what its jobs write out
+//  instead of running it, if it couldn't be read or compiled.
+template<typename C, typename P> struct batch_program_t {
+        std::unique_ptr<reader_t> source;
+        std::unique_ptr<bf::program_t<C, P> > compiled;
+        std::string error;
+};
+
+template<typename C, typename P>
+void compile_batch_program(const std::string& path, bool ignore_unknowns, const bf::cache_t* cache, batch_program_t<C, P>& program)
+{
+        try {
+                program.source.reset(new reader_t(path.c_str()));
+        }
+        catch (std::runtime_error& e) {
+                program.error = std::string(e.what()) + "\n";
+                return;
+        }
+
+        try {
+                if (cache)
+                        program.compiled.reset(new bf::program_t<C, P>(cache->load<C, P>(program.source->raw(), program.source->size(), ignore_unknowns)));
+                else
+                        program.compiled.reset(new bf::program_t<C, P>(program.source->raw(), program.source->size(), ignore_unknowns));
+        }
+        catch (bf::error_t& e) {
+                std::ostringstream out;
+
+                display_error_cause(out, e.what(), program.source->raw(), program.source->size(), e.commands);
+                program.error = out.str();
+        }
+}
+
+//! Opens the files of a job, returns why it couldn't.
+inline std::string open_batch_job(const batch_job_t& job, int& input, int& output)
+{
+        input = open(job.input == "-" ? "/dev/null" : job.input.c_str(), O_RDONLY);
+
+        if (input < 0)
+                return "can't open " + job.input;
+
+        output = open(job.output.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+
+        if (output < 0) {
+                close(input);
+                return "can't open " + job.output;
+        }
+
+        return std::string();
+}
+
+//! Writes out the error a job ran into, if any, and closes its files. Returns why
+//  the job failed, if it did.
+inline std::string close_batch_job(const batch_job_t& job, const std::string& error, int input, int output)
+{
+        try {
+                fd_sink_t(output).write(error.data(), error.size());
+        }
+        catch (std::runtime_error&) {
+        }
+
+        close(input);
+        close(output);
+
+        if (!error.empty())
+                return "program failed, see " + job.output;
+
+        return std::string();
+}
+
+//! Limits on every job of a batch, each job spending from a budget of its own. 0 for
+//  no limit.
+struct batch_limits_t {
+        batch_limits_t(uint64_t steps = 0, double seconds = 0) : steps(steps), seconds(seconds) {
+        }
+
+        bool enabled() const { return steps != 0 || seconds != 0; }
+
+        uint64_t steps;
+        double seconds;
+};
+
+//! Runs one job. Output, and an error like the one evaluating the program on its own
+//  would show, go to the job's output file. Returns why it failed, if it did, with
+//  status set to budget_exit_status if it was stopped at a limit.
+template<typename C, typename S, typename P>
+std::string run_batch_job(const batch_job_t& job, batch_program_t<C, P>& program, bf::execution_t<C, S, P>& execution,
+                          const batch_limits_t& limits, int& status)
+{
+        int input = -1, output = -1;
+        std::string failure = open_batch_job(job, input, output);
+
+        status = EXIT_FAILURE;
+
+        if (!failure.empty())
+                return failure;
+
+        std::string error = program.error;
+        budget_t budget(limits.steps, limits.seconds);
+
+        if (error.empty()) {
+                try {
+                        if (limits.enabled())
+                                execution.run(*program.compiled, input, output, budget);
+                        else
+                                execution.run(*program.compiled, input, output);
+                }
+                catch (bf::limit_reached_t& e) {
+                        std::ostringstream out;
+
+                        status = display_limit_reached(out, budget, program.source->raw(), program.source->size(), e.commands[0], execution.state());
+                        error = out.str();
+                }
+                catch (bf::error_t& e) {
+                        std::ostringstream out;
+
+                        display_error_cause(out, e.what(), program.source->raw(), program.source->size(), e.commands);
+                        error = out.str();
+                }
+        }
+
+        failure = close_batch_job(job, error, input, output);
+
+        if (!failure.empty() && status == budget_exit_status)
+                failure = std::string(budget.reached()) + ", see " + job.output;
+
+        return failure;
+}
+
+//! Splits the jobs into groups of at most size, each group running a single program.
+inline void group_batch_jobs(const std::vector<batch_job_t>& jobs, std::size_t programs, std::size_t size, std::vector<std::vector<std::size_t> >& groups)
+{
+        std::vector<std::size_t> filling(programs, static_cast<std::size_t>(-1));
+
+        for (std::size_t i = 0; i != jobs.size(); ++i) {
+                std::size_t& group = filling[jobs[i].program];
+
+                if (group == static_cast<std::size_t>(-1) || groups[group].size() == size) {
+                        group = groups.size();
+                        groups.push_back(std::vector<std::size_t>());
+                }
+
+                groups[group].push_back(i);
+        }
+}
+
+//! Runs a group of jobs of one program side by side, a lane each, as run_batch_job
+//  would run them one after the other.
+template<typename C, typename P>
+void run_batch_lanes(const std::vector<batch_job_t>& jobs, const std::vector<std::size_t>& group, batch_program_t<C, P>& program,
+                     lanes_t<C>& lanes, std::vector<std::string>& failures)
+{
+        std::vector<std::size_t> running;
+        std::vector<int> inputs, outputs;
+
+        for (std::size_t i = 0; i != group.size(); ++i) {
+                int input = -1, output = -1;
+
+                failures[group[i]] = open_batch_job(jobs[group[i]], input, output);
+
+                if (!failures[group[i]].empty())
+                        continue;
+
+                lanes.io(running.size()).attach(input, output, FLUSH_Block);
+                running.push_back(group[i]);
+                inputs.push_back(input);
+                outputs.push_back(output);
+        }
+
+        if (program.error.empty())
+                lanes.run(program.compiled->bytecode(), program.compiled->prefix(), running.size());
+
+        for (std::size_t lane = 0; lane != running.size(); ++lane) {
+                std::string error = program.error;
+
+                if (error.empty() && !lanes.error(lane).empty()) {
+                        std::ostringstream out;
+
+                        display_error_cause(out, lanes.error(lane).c_str(), program.source->raw(), program.source->size(),
+                                            std::vector<unsigned int>(1, program.compiled->bytecode().positions[lanes.at(lane)]));
+                        error = out.str();
+                }
+
+                failures[running[lane]] = close_batch_job(jobs[running[lane]], error, inputs[lane], outputs[lane]);
+        }
+}
+
+} // namespace detail
+
+//! Runs every job of a manifest on workers threads. Each distinct program is compiled
+//  once, up front and in parallel, then the jobs are spread over the workers, each
+//  with an execution that it reuses - tiered, unless told otherwise. The lanes engine
+//  spreads groups of jobs of the same program instead, and only wraps. Programs are
+//  read from and kept in cache, unless it is null. Every job gets its own budget of
+//  limits, which the lanes engine doesn't take. Jobs that fail are listed on stderr
+//  once all of them have run; if each of them was stopped at a limit the status is
+//  budget_exit_status.
+template<typename C, typename S, typename P>
+int evaluate_batch(const char* manifest, size_t manifest_size, bool ignore_unknowns, detail::eof_t eof, unsigned int workers,
+                   detail::batch_engine_t engine = detail::BATCH_Tiered, const bf::cache_t* cache = 0,
+                   const detail::batch_limits_t& limits = detail::batch_limits_t())
+{
+        std::vector<detail::batch_job_t> jobs;
+        std::vector<std::string> paths;
+
+        try {
+                detail::parse_manifest(manifest, manifest_size, jobs, paths);
+        }
+        catch (std::runtime_error& e) {
+                std::cout<<e.what()<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        std::vector<detail::batch_program_t<C, P> > programs(paths.size());
+
+        detail::run_workers(workers, programs.size(), [&](std::size_t, std::size_t i) {
+                detail::compile_batch_program<C, P>(paths[i], ignore_unknowns, cache, programs[i]);
+        });
+
+        std::vector<std::string> failures(jobs.size());
+        std::vector<int> statuses(jobs.size(), EXIT_FAILURE);
+
+        if (engine == detail::BATCH_Lanes) {
+                std::vector<std::vector<std::size_t> > groups;
+                std::vector<std::unique_ptr<detail::lanes_t<C> > > lanes(workers);
+
+                detail::group_batch_jobs(jobs, programs.size(), detail::lanes_t<C>::count, groups);
+
+                detail::run_workers(workers, groups.size(), [&](std::size_t worker, std::size_t i) {
+                        if (!lanes[worker])
+                                lanes[worker].reset(new detail::lanes_t<C>(eof));
+
+                        detail::run_batch_lanes(jobs, groups[i], programs[jobs[groups[i][0]].program], *lanes[worker], failures);
+                });
+        }
+        else {
+                std::vector<std::unique_ptr<bf::execution_t<C, S, P> > > executions(workers);
+
+                detail::run_workers(workers, jobs.size(), [&](std::size_t worker, std::size_t i) {
+                        if (!executions[worker])
+                                executions[worker].reset(new bf::execution_t<C, S, P>(detail::FLUSH_Block, eof, engine == detail::BATCH_Tiered));
+
+                        failures[i] = detail::run_batch_job(jobs[i], programs[jobs[i].program], *executions[worker], limits, statuses[i]);
+                });
+        }
+
+        std::size_t failed = 0, limited = 0;
+
+        for (std::size_t i = 0; i != jobs.size(); ++i) {
+                if (failures[i].empty())
+                        continue;
+
+                std::cerr<<"manifest line "<<jobs[i].line<<": "<<failures[i]<<std::endl;
+                ++failed;
+
+                if (statuses[i] == detail::budget_exit_status)
+                        ++limited;
+        }
+
+        if (failed != 0) {
+                std::cerr<<failed<<" of "<<jobs.size()<<" jobs failed"<<std::endl;
+                return limited == failed ? detail::budget_exit_status : EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+}
+
+#endif /* _H_BF_BATCH */
\ No newline at end of file
@@ -0,0 +1,170 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_BUDGET
+#define _H_BF_BUDGET
+
+#include "bf_inline.h"
+
+#include <stdint.h>
+
+#include <type_traits>
+#include <stdexcept>
+#include <ostream>
+#include <chrono>
+#include <cstddef>
+
+namespace detail {
+
+const uint64_t budget_slice = uint64_t(1) << 16;   // steps between looks at the clock
+const int budget_exit_status = 124;                 // a run that reached a limit, as timeout(1)
+
+//! No limits - back-edges cost nothing and aren't counted.
+struct no_budget_t {
+        static const bool enabled = false;
+
+        void start() {}
+        bool spend() { return true; }
+        bool spend(uint64_t) { return true; }
+        const char* reached() const { return 0; }
+};
+
+//! Limits on a run: steps - back-edges of the loops left once the program is
+//  optimized, so every engine counts the same - and seconds, 0 for no limit.
+//  spend is called on every back-edge and only counts down a slice of steps, the
+//  clock is read once a slice is used up. Native code keeps the slice in a register
+//  and hands it back and forth with left.
+struct budget_t {
+        static const bool enabled = true;
+
+        explicit budget_t(uint64_t steps = 0, double seconds = 0);
+
+        void start();
+        BF_ALWAYS_INLINE bool spend() { return left_-- != 0 || refill(); }
+        bool spend(uint64_t steps);          // many at once, the ones a folded prefix took
+        bool refill();                       // the next slice, false once a limit is reached
+
+        uint64_t left() const { return left_; }
+        void left(uint64_t steps) { left_ = steps; }
+
+        uint64_t taken() const { return granted_ - left_; }
+        double elapsed() const;
+        const char* reached() const { return reached_; }  // which limit, 0 for neither
+
+private:
+        typedef std::chrono::steady_clock clock_type;
+
+        uint64_t steps_;
+        uint64_t left_;
+        uint64_t granted_;
+        double seconds_;
+        clock_type::time_point started_;
+        clock_type::time_point deadline_;
+        const char* reached_;
+};
+
+//! Thrown by the interpreters once spend fails, what is budget.reached().
+struct budget_exceeded_t : std::runtime_error {
+        explicit budget_exceeded_t(const char* limit) : std::runtime_error(limit) {
+        }
+};
+
+inline budget_t::budget_t(uint64_t steps, double seconds) : steps_(steps), left_(0), granted_(0), seconds_(seconds), reached_(0)
+{
+}
+
+inline void budget_t::start()
+{
+        left_ = granted_ = 0;
+        reached_ = 0;
+        started_ = clock_type::now();
+        deadline_ = started_ + std::chrono::duration_cast<clock_type::duration>(std::chrono::duration<double>(seconds_));
+}
+
+inline bool budget_t::refill()
+{
+        left_ = 0;
+
+        if (seconds_ > 0 && clock_type::now() >= deadline_) {
+                reached_ = "time limit reached";
+                return false;
+        }
+
+        uint64_t remaining = steps_ ? steps_ - granted_ : budget_slice;
+
+        if (remaining == 0) {
+                reached_ = "step limit reached";
+                return false;
+        }
+
+        uint64_t grant = remaining < budget_slice ? remaining : budget_slice;
+
+        granted_ += grant;
+        left_ = grant - 1;                   // this back-edge is the first of them
+
+        return true;
+}
+
+inline bool budget_t::spend(uint64_t steps)
+{
+        while (steps > left_) {
+                steps -= left_ + 1;
+
+                if (!refill())
+                        return false;
+        }
+
+        left_ -= steps;
+        return true;
+}
+
+inline double budget_t::elapsed() const
+{
+        return std::chrono::duration<double>(clock_type::now() - started_).count();
+}
+
+//! How far the run got and the cells around the pointer, the current one bracketed.
+//  cell(index) reads the cell index places right of the origin, count is one past
+//  the last cell written to - the ones after it aren't shown unless the pointer is
+//  on them.
+template<typename C, typename F>
+void display_budget_state(std::ostream& out, const budget_t& budget, F cell, std::size_t count, std::size_t pointer)
+{
+        typedef typename std::conditional<std::is_signed<C>::value, long long, unsigned long long>::type value_t;
+
+        const std::size_t shown = 8;
+        std::size_t first = pointer > shown ? pointer - shown : 0;
+        std::size_t end = count > pointer ? count : pointer + 1;
+        std::size_t last = pointer + shown + 1 < end ? pointer + shown + 1 : end;
+
+        out<<"Steps: "<<budget.taken()<<", seconds: "<<budget.elapsed()<<std::endl;
+        out<<"Pointer: "<<pointer<<", cells from "<<first<<":";
+
+        for (std::size_t i = first; i < last; ++i) {
+                if (i == pointer)
+                        out<<" ["<<static_cast<value_t>(cell(i))<<"]";
+                else
+                        out<<" "<<static_cast<value_t>(cell(i));
+        }
+
+        out<<std::endl;
+}
+
+} // namespace detail
+
+#endif /* _H_BF_BUDGET */
\ No newline at end of file
@@ -0,0 +1,585 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_BYTECODE
+#define _H_BF_BYTECODE
+
+#include "bf_syntax.h"
+#include "bf_scan.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <map>
+#include <cstddef>
+#include <cstdlib>
+
+namespace detail {
+
+//! Operations of the linear intermediate representation.
+enum opcode_t {
+        OP_Add          // cell[offset] += operand
+      , OP_Move         // pc += operand
+      , OP_Output       // write cell[offset], operand times
+      , OP_Input        // read into cell[offset]
+      , OP_Open         // if cell == 0 continue after the instruction at operand
+      , OP_Close        // if cell != 0 continue after the instruction at operand
+      , OP_Clear        // cell[offset] = 0, ends a loop that counts the cell down
+      , OP_MulAdd       // cell[offset] += cell * operand
+      , OP_Scan         // pc += operand until cell == 0
+      , OP_Set          // cell[offset] = operand, only for values known at compile time
+      , OP_Halt
+      , OP_Count
+};
+
+//! A single instruction. Jump targets are instruction indices.
+struct instruction_t {
+        int opcode;
+        int operand;
+        int offset;
+};
+
+//! A compiled program - the instructions and, for diagnostics, the source index
+//  each instruction was produced from.
+struct bytecode_t {
+        std::vector<instruction_t> code;
+        std::vector<unsigned int>  positions;
+
+        void emit(int opcode, int operand, int offset, unsigned int position);
+        void truncate(std::size_t size);
+};
+
+inline void bytecode_t::emit(int opcode, int operand, int offset, unsigned int position)
+{
+        instruction_t instruction = { opcode, operand, offset };
+
+        code.push_back(instruction);
+        positions.push_back(position);
+}
+
+inline void bytecode_t::truncate(std::size_t size)
+{
+        code.resize(size);
+        positions.resize(size);
+}
+
+//! Whether the instruction works on the cell at its offset - the others work on the
+//  cell at the pc, or move it.
+inline bool addresses_cell(int opcode)
+{
+        switch (opcode) {
+        case OP_Add: case OP_Set: case OP_Output: case OP_Input: case OP_Clear: case OP_MulAdd:
+                return true;
+        }
+
+        return false;
+}
+
+//! Lowest and highest cell offsets the program accesses relative to the pointer.
+inline void offset_range(const bytecode_t& bytecode, int& lowest, int& highest)
+{
+        lowest = highest = 0;
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i) {
+                const instruction_t& instruction = bytecode.code[i];
+
+                if (instruction.opcode == OP_Move || instruction.opcode == OP_Open || instruction.opcode == OP_Close)
+                        continue;
+
+                if (instruction.offset < lowest)
+                        lowest = instruction.offset;
+                if (instruction.offset > highest)
+                        highest = instruction.offset;
+        }
+}
+
+//! Throws if the cells the program accesses can be reach or more cells away from
+//  the last one it is known to have accessed, for tapes bounded by guard pages
+//  rather than checks. Jumps land right after a loop's test of the current cell,
+//  so one pass in order sees every path.
+inline void check_reach(const bytecode_t& bytecode, std::size_t reach)
+{
+        long long moved = 0;                 // since the current cell was last tested
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i) {
+                const instruction_t& instruction = bytecode.code[i];
+                long long farthest = 0;
+
+                switch (instruction.opcode) {
+                case OP_Move:
+                        moved += instruction.operand;
+                        continue;
+                case OP_Open: case OP_Close: case OP_MulAdd:
+                        farthest = moved;
+                        break;
+                case OP_Scan:
+                        farthest = std::max(std::llabs(moved), std::llabs(instruction.operand));
+                        break;
+                }
+
+                if (addresses_cell(instruction.opcode))
+                        farthest = std::max(std::llabs(farthest), std::llabs(moved + instruction.offset));
+
+                if (static_cast<unsigned long long>(std::llabs(farthest)) >= reach)
+                        throw syntax_error("moves past the guard pages of the tape", bytecode.positions[i]);
+
+                if (instruction.opcode == OP_Open || instruction.opcode == OP_Close || instruction.opcode == OP_Scan || instruction.opcode == OP_MulAdd)
+                        moved = 0;
+        }
+}
+
+constexpr bool is_command(char command)
+{
+        switch (command) {
+        case '>': case '<': case '+': case '-':
+        case '.': case ',': case '[': case ']':
+                return true;
+        }
+
+        return false;
+}
+
+//! Index of the first command at or after position, or program_size. Comments are
+//  skipped a vector at a time, so mostly commented programs need no copy that
+//  filters them out.
+inline size_t next_command(const char* program, size_t program_size, size_t position)
+{
+#if defined(BF_HAVE_SIMD_SCAN)
+        const __m128i plus  = _mm_set1_epi8('+'), comma = _mm_set1_epi8(','), minus = _mm_set1_epi8('-'), dot   = _mm_set1_epi8('.');
+        const __m128i less  = _mm_set1_epi8('<'), more  = _mm_set1_epi8('>'), open  = _mm_set1_epi8('['), close = _mm_set1_epi8(']');
+
+        for (; position + 16 <= program_size; position += 16) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(program + position));
+                __m128i found = _mm_or_si128(
+                        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, plus), _mm_cmpeq_epi8(block, comma)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(block, minus), _mm_cmpeq_epi8(block, dot))),
+                        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, less), _mm_cmpeq_epi8(block, more)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(block, open), _mm_cmpeq_epi8(block, close))));
+
+                if (unsigned int mask = _mm_movemask_epi8(found))
+                        return position + __builtin_ctz(mask);
+        }
+#endif
+
+        while (position != program_size && !is_command(program[position]))
+                ++position;
+
+        return position;
+}
+
+//! Characters that never produce an instruction.
+constexpr bool is_skippable(char command, bool ignore_unknowns)
+{
+        return command == ' ' || command == '\n' || (ignore_unknowns && !is_command(command));
+}
+
+//! Sums a run of commands made of up/down (and anything skippable), returns the net value.
+//  Unless nets is set the run stops where it changes direction - cells checked at
+//  their limits can go past one on the way to a net value that is in range.
+constexpr int run_value(const char* program, size_t program_size, unsigned int& command_index, char up, char down, bool ignore_unknowns, bool nets = true)
+{
+        int value = 0;
+
+        for (; command_index != program_size; ++command_index) {
+                char command = program[command_index];
+
+                if (command == up && (nets || value >= 0))
+                        ++value;
+                else if (command == down && (nets || value <= 0))
+                        --value;
+                else if (!is_skippable(command, ignore_unknowns))
+                        break;
+        }
+
+        return value;
+}
+
+//! Counts a run of '.' (and anything skippable).
+constexpr int run_length(const char* program, size_t program_size, unsigned int& command_index, bool ignore_unknowns)
+{
+        int length = 0;
+
+        for (; command_index != program_size; ++command_index) {
+                char command = program[command_index];
+
+                if (command == '.')
+                        ++length;
+                else if (!is_skippable(command, ignore_unknowns))
+                        break;
+        }
+
+        return length;
+}
+
+//! Replaces a just closed loop with composite instructions if its body allows it.
+//  A body that only moves is a scan for a zero cell. A body that only adds and
+//  moves, ends where it started and decrements the current cell by one runs cell
+//  times, so each of its adds becomes a multiply-add and the loop a clear. Unless
+//  cells wrap, each cell has to be added to in one direction only, then it goes
+//  past a limit exactly when the result of the multiply-add does.
+inline bool fuse_loop(bytecode_t& bytecode, std::size_t open, bool wraps)
+{
+        const instruction_t* body = &bytecode.code[open + 1];
+        std::size_t body_size = bytecode.code.size() - open - 1;
+        unsigned int position = bytecode.positions[open];
+
+        if (body_size == 1 && body[0].opcode == OP_Move) {
+                int stride = body[0].operand;
+
+                bytecode.truncate(open);
+                bytecode.emit(OP_Scan, stride, 0, position);
+                return true;
+        }
+
+        std::map<int, int> deltas;
+        int pointer = 0;
+
+        for (std::size_t i = 0; i != body_size; ++i) {
+                switch (body[i].opcode) {
+                case OP_Add: {
+                        int& delta = deltas[pointer + body[i].offset];
+
+                        if (!wraps && delta != 0 && (delta < 0) != (body[i].operand < 0))
+                                return false;
+
+                        delta += body[i].operand;
+                        break;
+                }
+                case OP_Move:
+                        pointer += body[i].operand;
+                        break;
+                default:
+                        return false;
+                }
+        }
+
+        if (pointer != 0 || deltas[0] != -1)
+                return false;
+
+        bytecode.truncate(open);
+
+        for (std::map<int, int>::const_iterator i = deltas.begin(); i != deltas.end(); ++i)
+                if (i->first != 0 && i->second != 0)
+                        bytecode.emit(OP_MulAdd, i->second, i->first, position);
+
+        bytecode.emit(OP_Clear, 0, 0, position);
+        return true;
+}
+
+//! Appends an instruction, pointing the jumps of a loop at each other once it closes.
+inline void relink(bytecode_t& bytecode, std::vector<std::size_t>& opens, const instruction_t& instruction, unsigned int position)
+{
+        if (instruction.opcode == OP_Open) {
+                opens.push_back(bytecode.code.size());
+                bytecode.emit(OP_Open, 0, instruction.offset, position);
+                return;
+        }
+
+        if (instruction.opcode == OP_Close) {
+                std::size_t open = opens.back();
+
+                opens.pop_back();
+                bytecode.code[open].operand = static_cast<int>(bytecode.code.size());
+                bytecode.emit(OP_Close, static_cast<int>(open), instruction.offset, position);
+                return;
+        }
+
+        bytecode.emit(instruction.opcode, instruction.operand, instruction.offset, position);
+}
+
+//! Largest value the known value analysis tracks. Up to it, adding up known values
+//  gives the same result whatever the cell width, signedness or overflow policy.
+const int known_value_limit = 127;
+const int unknown_value = -1;
+
+//! What is known about the cells while walking the bytecode - values by position
+//  relative to where the walk last lost track of the pc, and the sets that no
+//  instruction has read yet, by the same positions.
+struct known_cells_t {
+        known_cells_t() : pointer(0), zeroed(true) {
+        }
+
+        int value(int position) const;
+        void forget(bool current_zero);        // after a loop or a scan, anything may have changed
+
+        int pointer;
+        bool zeroed;                           // cells that aren't in values are zero
+        std::map<int, int> values;
+        std::map<int, std::size_t> stores;
+};
+
+inline int known_cells_t::value(int position) const
+{
+        std::map<int, int>::const_iterator i = values.find(position);
+
+        if (i != values.end())
+                return i->second;
+
+        return zeroed ? 0 : unknown_value;
+}
+
+inline void known_cells_t::forget(bool current_zero)
+{
+        pointer = 0;
+        zeroed = false;
+        values.clear();
+        stores.clear();
+
+        if (current_zero)
+                values[0] = 0;
+}
+
+//! Known value analysis. Walks the bytecode once, from a tape that starts out zeroed,
+//  and keeps track of the cells whose value it can tell: a cell is zero after a
+//  loop, a clear or a scan, adds and multiply-adds on known cells give known cells.
+//  With that it
+//  - removes loops, clears, scans and multiply-adds whose cell is known to be zero,
+//    leading comment loops and loops right after another loop's ']' among them,
+//  - turns adds onto a known cell into sets and clears of a known cell into set 0,
+//  - removes sets that another set overwrites before anything reads them.
+//  The pc is only tracked between loops, a loop body starts out knowing nothing.
+inline void propagate_known_values(bytecode_t& bytecode)
+{
+        bytecode_t result;
+        std::vector<bool> dead;
+        std::vector<std::size_t> opens;
+        known_cells_t known;
+
+        result.code.reserve(bytecode.code.size());
+        result.positions.reserve(bytecode.code.size());
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i) {
+                const instruction_t& instruction = bytecode.code[i];
+                unsigned int position = bytecode.positions[i];
+                int at = known.pointer + instruction.offset;
+                int current = known.value(known.pointer);
+                int value = unknown_value;
+
+                switch (instruction.opcode) {
+                case OP_Add:
+                        if (known.value(at) != unknown_value)
+                                value = known.value(at) + instruction.operand;
+                        break;
+                case OP_Set:
+                        value = instruction.operand;
+                        break;
+                case OP_MulAdd:
+                        if (current == 0)
+                                continue;
+                        if (current != unknown_value && known.value(at) != unknown_value)
+                                value = known.value(at) + current * instruction.operand;
+                        break;
+                case OP_Clear:
+                        if (known.value(at) == 0)
+                                continue;
+                        if (known.value(at) != unknown_value)
+                                value = 0;
+                        break;
+                case OP_Scan:
+                        if (current == 0)
+                                continue;
+                        result.emit(OP_Scan, instruction.operand, instruction.offset, position);
+                        dead.push_back(false);
+                        known.forget(true);
+                        continue;
+                case OP_Move:
+                        known.pointer += instruction.operand;
+                        result.emit(OP_Move, instruction.operand, instruction.offset, position);
+                        dead.push_back(false);
+                        continue;
+                case OP_Open:
+                case OP_Close:
+                        if (instruction.opcode == OP_Open && current == 0) {
+                                i = instruction.operand;
+                                continue;
+                        }
+                        relink(result, opens, instruction, position);
+                        dead.push_back(false);
+                        known.forget(instruction.opcode == OP_Close);
+                        continue;
+                }
+
+                if (value >= 0 && value <= known_value_limit) {
+                        //! Whatever set the cell before went unread.
+                        std::map<int, std::size_t>::iterator store = known.stores.find(at);
+
+                        if (store != known.stores.end())
+                                dead[store->second] = true;
+
+                        known.stores[at] = result.code.size();
+                        known.values[at] = value;
+                        result.emit(OP_Set, value, instruction.offset, position);
+                        dead.push_back(false);
+                        continue;
+                }
+
+                //! Everything else reads the cell at offset, multiply-adds the current
+                //  cell as well. Output leaves it be.
+                known.stores.erase(at);
+                known.stores.erase(known.pointer);
+
+                if (instruction.opcode != OP_Output)
+                        known.values[at] = instruction.opcode == OP_Clear ? 0 : unknown_value;
+
+                result.emit(instruction.opcode, instruction.operand, instruction.offset, position);
+                dead.push_back(false);
+        }
+
+        //! Drop the overwritten sets, jumps are renumbered.
+        std::vector<int> renumbered(result.code.size());
+
+        bytecode.truncate(0);
+
+        for (std::size_t i = 0; i != result.code.size(); ++i) {
+                renumbered[i] = static_cast<int>(bytecode.code.size());
+
+                if (!dead[i])
+                        bytecode.emit(result.code[i].opcode, result.code[i].operand, result.code[i].offset, result.positions[i]);
+        }
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i)
+                if (bytecode.code[i].opcode == OP_Open || bytecode.code[i].opcode == OP_Close)
+                        bytecode.code[i].operand = renumbered[bytecode.code[i].operand];
+}
+
+//! Pointer movement elimination. Within straight line code moves are put off and
+//  the cells are addressed relative to where the pc was at the start, so each block
+//  moves the pc once, at its end - before a loop's '[' or ']', a scan or a
+//  multiply-add, which all work on the cell at the pc. Like moves folded at the
+//  front end, only the net movement of a block is checked against the tape's start.
+inline void defer_moves(bytecode_t& bytecode)
+{
+        bytecode_t result;
+        std::vector<std::size_t> opens;
+        int pending = 0;
+        unsigned int pending_position = 0;
+
+        result.code.reserve(bytecode.code.size());
+        result.positions.reserve(bytecode.code.size());
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i) {
+                instruction_t instruction = bytecode.code[i];
+                unsigned int position = bytecode.positions[i];
+
+                switch (instruction.opcode) {
+                case OP_Move:
+                        if (pending == 0)
+                                pending_position = position;
+                        pending += instruction.operand;
+                        continue;
+                case OP_Add:
+                case OP_Set:
+                case OP_Output:
+                case OP_Input:
+                case OP_Clear:
+                        instruction.offset += pending;
+                        result.emit(instruction.opcode, instruction.operand, instruction.offset, position);
+                        continue;
+                }
+
+                if (pending != 0)
+                        result.emit(OP_Move, pending, 0, pending_position);
+
+                pending = 0;
+                relink(result, opens, instruction, position);
+        }
+
+        bytecode.code.swap(result.code);
+        bytecode.positions.swap(result.positions);
+}
+
+//! Front end - lowers the source into bytecode. Runs of '+'/'-', '>'/'<' and '.'
+//  are folded into single instructions, loops are paired up or fused, then what
+//  known cell values make redundant is taken out and the moves put off, unless
+//  deferred is unset - a move put off is folded into the instructions after it, so
+//  the pc at an instruction's position in the source is only known without. Unless
+//  cells wrap, see the overflow policies, '+' and '-' aren't netted against each
+//  other.
+inline void compile(const char* program, size_t program_size, bool ignore_unknowns, bytecode_t& bytecode, bool wraps = true,
+                    bool deferred = true)
+{
+        bracket_matcher_t brackets;
+        unsigned int command_index = 0;
+
+        bytecode.code.reserve(program_size + 1);
+        bytecode.positions.reserve(program_size + 1);
+
+        while (command_index != program_size) {
+                unsigned int position = command_index;
+                int value;
+
+                switch (program[command_index]) {
+                case '+':
+                case '-':
+                        if ((value = run_value(program, program_size, command_index, '+', '-', ignore_unknowns, wraps)) != 0)
+                                bytecode.emit(OP_Add, value, 0, position);
+                        continue;
+                case '>':
+                case '<':
+                        if ((value = run_value(program, program_size, command_index, '>', '<', ignore_unknowns)) != 0)
+                                bytecode.emit(OP_Move, value, 0, position);
+                        continue;
+                case '.':
+                        bytecode.emit(OP_Output, run_length(program, program_size, command_index, ignore_unknowns), 0, position);
+                        continue;
+                case ',':
+                        bytecode.emit(OP_Input, 0, 0, position);
+                        break;
+                case '[':
+                        brackets.open(command_index, bytecode.code.size());
+                        bytecode.emit(OP_Open, 0, 0, position);
+                        break;
+                case ']': {
+                        std::size_t open;
+
+                        if (!brackets.close(command_index, open))
+                                break;
+
+                        if (fuse_loop(bytecode, open, wraps))
+                                break;
+
+                        bytecode.code[open].operand = static_cast<int>(bytecode.code.size());
+                        bytecode.emit(OP_Close, static_cast<int>(open), 0, position);
+                        break;
+                }
+                default:
+                        if (ignore_unknowns) {
+                                command_index = static_cast<unsigned int>(next_command(program, program_size, command_index + 1));
+                                continue;
+                        }
+
+                        if (!is_skippable(program[command_index], ignore_unknowns))
+                                throw syntax_error("found an invalid command", command_index);
+                }
+
+                ++command_index;
+        }
+
+        brackets.finish();
+
+        bytecode.emit(OP_Halt, 0, 0, command_index);
+
+        propagate_known_values(bytecode);
+
+        if (deferred)
+                defer_moves(bytecode);
+}
+
+} // namespace detail
+
+#endif /* _H_BF_BYTECODE */
\ No newline at end of file
@@ -0,0 +1,422 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_CACHE
+#define _H_BF_CACHE
+
+#include "bf_program.h"
+#include "bf_bytecode.h"
+#include "bf_prefix.h"
+#include "bf_policy.h"
+#include "bf_io.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include <type_traits>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+namespace detail {
+
+const uint32_t cache_version = 4;                               // bump whenever the bytecode changes meaning
+const std::size_t cache_limit_bytes = std::size_t(64) << 20;   // default bound on a cache directory
+const char cache_magic[8] = { 'B', 'F', 'C', 'A', 'C', 'H', 'E', 0 };
+const char cache_suffix[] = ".bfc";
+
+const uint64_t fnv1a_basis = 14695981039346656037ull;
+
+inline uint64_t fnv1a(uint64_t hash, const void* data, std::size_t size)
+{
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+        for (std::size_t i = 0; i != size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+        }
+
+        return hash;
+}
+
+//! The overflow policy an entry was folded with - the prefix depends on it.
+template<typename P> struct cache_policy;
+
+template<> struct cache_policy<wrap_policy_t>     { static const uint32_t id = 0; };
+template<> struct cache_policy<trap_policy_t>     { static const uint32_t id = 1; };
+template<> struct cache_policy<saturate_policy_t> { static const uint32_t id = 2; };
+
+enum cache_flags_t {
+        CACHE_SignedCells     = 1
+      , CACHE_IgnoreUnknowns  = 2
+};
+
+//! Everything a compiled program depends on. An entry is found by a hash of it and
+//  only used if it matches in full - the source included, which the entry keeps, as
+//  the hash of the source is easily made to collide.
+struct cache_key_t {
+        uint64_t source_hash;
+        uint64_t source_size;
+        uint32_t cell_bytes;
+        uint32_t flags;
+        uint32_t policy;
+        uint32_t version;
+};
+
+template<typename C, typename P> cache_key_t cache_key(const char* source, std::size_t source_size, bool ignore_unknowns)
+{
+        cache_key_t key;
+
+        std::memset(&key, 0, sizeof key);
+        key.source_hash = fnv1a(fnv1a_basis, source, source_size);
+        key.source_size = source_size;
+        key.cell_bytes  = sizeof(C);
+        key.flags       = (std::is_signed<C>::value ? CACHE_SignedCells : 0) | (ignore_unknowns ? CACHE_IgnoreUnknowns : 0);
+        key.policy      = cache_policy<P>::id;
+        key.version     = cache_version;
+
+        return key;
+}
+
+inline std::string cache_entry_name(const cache_key_t& key)
+{
+        char name[32];
+
+        std::snprintf(name, sizeof name, "%016llx%s", static_cast<unsigned long long>(fnv1a(fnv1a_basis, &key, sizeof key)), cache_suffix);
+        return name;
+}
+
+//! An entry is this header followed by the instructions, their source positions,
+//  the prefix image, the prefix output and the source. Each section but the last
+//  starts 8 byte aligned, so they can be read in place from a mapping of the file.
+struct cache_header_t {
+        char magic[8];
+        uint32_t header_bytes;               // catches layout changes the version missed
+        uint32_t instructions;
+        cache_key_t key;
+        uint64_t image_cells;
+        uint64_t output_bytes;
+        uint32_t pointer;
+        uint32_t reserved;
+        uint64_t steps;                      // back-edges the prefix took
+        uint64_t payload_hash;               // of everything after the header
+};
+
+struct cache_layout_t {
+        std::size_t code;
+        std::size_t positions;
+        std::size_t image;
+        std::size_t output;
+        std::size_t source;
+        std::size_t end;
+};
+
+inline std::size_t cache_align(std::size_t offset)
+{
+        return (offset + 7) & ~std::size_t(7);
+}
+
+template<typename C> cache_layout_t cache_layout(const cache_header_t& header)
+{
+        cache_layout_t layout;
+
+        layout.code      = cache_align(sizeof(cache_header_t));
+        layout.positions = cache_align(layout.code + header.instructions * sizeof(instruction_t));
+        layout.image     = cache_align(layout.positions + header.instructions * sizeof(unsigned int));
+        layout.output    = cache_align(layout.image + header.image_cells * sizeof(C));
+        layout.source    = layout.output + header.output_bytes;
+        layout.end       = layout.source + header.key.source_size;
+
+        return layout;
+}
+
+//! Whether bytecode read back from an entry is safe to run - known opcodes, loops
+//  that pair up, scans that move and a single Halt at the end.
+inline bool runnable(const bytecode_t& bytecode, std::size_t source_size)
+{
+        const std::vector<instruction_t>& code = bytecode.code;
+
+        if (code.empty() || code.back().opcode != OP_Halt)
+                return false;
+
+        for (std::size_t i = 0; i != code.size(); ++i) {
+                const instruction_t& instruction = code[i];
+
+                if (instruction.opcode < 0 || instruction.opcode >= OP_Count || bytecode.positions[i] > source_size)
+                        return false;
+
+                if (instruction.opcode == OP_Halt && i + 1 != code.size())
+                        return false;
+
+                if (instruction.opcode == OP_Scan && instruction.operand == 0)
+                        return false;
+
+                if (instruction.opcode == OP_Open || instruction.opcode == OP_Close) {
+                        int pair = instruction.opcode == OP_Open ? OP_Close : OP_Open;
+
+                        if (instruction.operand < 0 || static_cast<std::size_t>(instruction.operand) >= code.size())
+                                return false;
+
+                        if (code[instruction.operand].opcode != pair || code[instruction.operand].operand != static_cast<int>(i))
+                                return false;
+                }
+        }
+
+        return true;
+}
+
+//! Reads an entry out of size bytes at data. False unless it is intact and was
+//  compiled from source under key.
+template<typename C>
+bool decode_cache_entry(const char* data, std::size_t size, const cache_key_t& key, const char* source, bytecode_t& bytecode, prefix_t<C>& prefix)
+{
+        cache_header_t header;
+
+        if (size < sizeof header)
+                return false;
+
+        std::memcpy(&header, data, sizeof header);
+
+        if (std::memcmp(header.magic, cache_magic, sizeof header.magic) != 0 || header.header_bytes != sizeof header)
+                return false;
+
+        if (std::memcmp(&header.key, &key, sizeof key) != 0)
+                return false;
+
+        if (header.image_cells > fold_tape_limit || header.output_bytes > fold_output_limit || header.pointer > fold_tape_limit)
+                return false;
+
+        cache_layout_t layout = cache_layout<C>(header);
+
+        if (layout.end != size || fnv1a(fnv1a_basis, data + sizeof header, size - sizeof header) != header.payload_hash)
+                return false;
+
+        if (std::memcmp(data + layout.source, source, key.source_size) != 0)
+                return false;
+
+        bytecode.code.resize(header.instructions);
+        bytecode.positions.resize(header.instructions);
+        prefix.image.resize(header.image_cells);
+
+        if (header.instructions != 0) {
+                std::memcpy(&bytecode.code[0], data + layout.code, header.instructions * sizeof(instruction_t));
+                std::memcpy(&bytecode.positions[0], data + layout.positions, header.instructions * sizeof(unsigned int));
+        }
+
+        if (header.image_cells != 0)
+                std::memcpy(&prefix.image[0], data + layout.image, header.image_cells * sizeof(C));
+
+        prefix.output.assign(data + layout.output, header.output_bytes);
+        prefix.pointer = header.pointer;
+        prefix.steps = header.steps;
+
+        return runnable(bytecode, key.source_size);
+}
+
+template<typename C>
+bool read_cache_entry(const std::string& path, const cache_key_t& key, const char* source, bytecode_t& bytecode, prefix_t<C>& prefix)
+{
+        int fd = open(path.c_str(), O_RDONLY);
+
+        if (fd < 0)
+                return false;
+
+        struct stat status;
+        void* mapping = MAP_FAILED;
+
+        if (fstat(fd, &status) == 0 && status.st_size > 0)
+                mapping = mmap(0, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        //! Entries that are used are the last to be evicted.
+        if (mapping != MAP_FAILED)
+                futimens(fd, 0);
+
+        close(fd);
+
+        if (mapping == MAP_FAILED)
+                return false;
+
+        bool valid = decode_cache_entry(static_cast<const char*>(mapping), status.st_size, key, source, bytecode, prefix);
+
+        munmap(mapping, status.st_size);
+        return valid;
+}
+
+//! Writes an entry to a temporary file and renames it into place, so that readers
+//  see either the whole of it or nothing.
+template<typename C>
+void write_cache_entry(const std::string& directory, const std::string& path, const cache_key_t& key, const char* source, const bytecode_t& bytecode,
+                       const prefix_t<C>& prefix)
+{
+        cache_header_t header;
+
+        std::memset(&header, 0, sizeof header);
+        std::memcpy(header.magic, cache_magic, sizeof header.magic);
+        header.header_bytes = sizeof header;
+        header.instructions = static_cast<uint32_t>(bytecode.code.size());
+        header.key          = key;
+        header.image_cells  = prefix.image.size();
+        header.output_bytes = prefix.output.size();
+        header.pointer      = prefix.pointer;
+        header.steps        = prefix.steps;
+
+        cache_layout_t layout = cache_layout<C>(header);
+        std::vector<char> data(layout.end);
+
+        if (header.instructions != 0) {
+                std::memcpy(&data[layout.code], &bytecode.code[0], header.instructions * sizeof(instruction_t));
+                std::memcpy(&data[layout.positions], &bytecode.positions[0], header.instructions * sizeof(unsigned int));
+        }
+
+        if (header.image_cells != 0)
+                std::memcpy(&data[layout.image], &prefix.image[0], header.image_cells * sizeof(C));
+
+        std::memcpy(&data[0] + layout.output, prefix.output.data(), header.output_bytes);
+        std::memcpy(&data[0] + layout.source, source, key.source_size);
+
+        header.payload_hash = fnv1a(fnv1a_basis, &data[sizeof header], data.size() - sizeof header);
+        std::memcpy(&data[0], &header, sizeof header);
+
+        std::string temporary = directory + "/.entry.XXXXXX";
+        int fd = mkstemp(&temporary[0]);
+
+        if (fd < 0)
+                return;
+
+        bool written = true;
+
+        try {
+                fd_sink_t(fd).write(&data[0], data.size());
+        }
+        catch (std::runtime_error&) {
+                written = false;
+        }
+
+        if (close(fd) != 0 || !written || rename(temporary.c_str(), path.c_str()) != 0)
+                unlink(temporary.c_str());
+}
+
+//! Removes the least recently used entries until the rest take up at most limit bytes.
+inline void evict_cache_entries(const std::string& directory, std::size_t limit)
+{
+        struct entry_t {
+                std::string path;
+                std::size_t size;
+                struct timespec used;
+        };
+
+        DIR* listing = opendir(directory.c_str());
+
+        if (!listing)
+                return;
+
+        std::vector<entry_t> entries;
+        std::size_t total = 0;
+        std::size_t suffix = std::strlen(cache_suffix);
+
+        while (struct dirent* found = readdir(listing)) {
+                std::string name(found->d_name);
+                struct stat status;
+
+                if (name.size() <= suffix || name.compare(name.size() - suffix, suffix, cache_suffix) != 0)
+                        continue;
+
+                entry_t entry;
+
+                entry.path = directory + "/" + name;
+
+                if (stat(entry.path.c_str(), &status) != 0)
+                        continue;
+
+                entry.size = status.st_size;
+                entry.used = status.st_mtim;
+                entries.push_back(entry);
+                total += entry.size;
+        }
+
+        closedir(listing);
+
+        if (total <= limit)
+                return;
+
+        std::sort(entries.begin(), entries.end(), [](const entry_t& a, const entry_t& b) {
+                return a.used.tv_sec != b.used.tv_sec ? a.used.tv_sec < b.used.tv_sec : a.used.tv_nsec < b.used.tv_nsec;
+        });
+
+        for (std::size_t i = 0; i != entries.size() && total > limit; ++i)
+                if (unlink(entries[i].path.c_str()) == 0 || errno == ENOENT)
+                        total -= entries[i].size;
+}
+
+} // namespace detail
+
+namespace bf {
+
+//! Compiled programs kept in a directory, so that a program that hasn't changed is
+//  read back instead of being compiled again. Entries are keyed by the source and
+//  the options the program was compiled with, and the directory is kept under limit
+//  bytes by evicting the least recently used ones. The cache is only ever a shortcut:
+//  if it can't be read or written the program is compiled as usual.
+struct cache_t {
+        explicit cache_t(const std::string& directory, std::size_t limit = detail::cache_limit_bytes);
+
+        //! Throws error_t if the program doesn't compile - failures aren't cached.
+        template<typename C, typename P> program_t<C, P> load(const char* source, std::size_t source_size, bool ignore_unknowns = false) const;
+
+private:
+        std::string directory_;
+        std::size_t limit_;
+};
+
+inline cache_t::cache_t(const std::string& directory, std::size_t limit) : directory_(directory), limit_(limit)
+{
+        mkdir(directory_.c_str(), 0777);
+}
+
+template<typename C, typename P> program_t<C, P> cache_t::load(const char* source, std::size_t source_size, bool ignore_unknowns) const
+{
+        detail::cache_key_t key = detail::cache_key<C, P>(source, source_size, ignore_unknowns);
+        std::string path = directory_ + "/" + detail::cache_entry_name(key);
+
+        detail::bytecode_t bytecode;
+        detail::prefix_t<C> prefix;
+
+        if (detail::read_cache_entry(path, key, source, bytecode, prefix))
+                return program_t<C, P>(std::move(bytecode), std::move(prefix));
+
+        program_t<C, P> program(source, source_size, ignore_unknowns);
+
+        detail::write_cache_entry(directory_, path, key, source, program.bytecode(), program.prefix());
+        detail::evict_cache_entries(directory_, limit_);
+
+        return program;
+}
+
+} // namespace bf
+
+#endif /* _H_BF_CACHE */
\ No newline at end of file
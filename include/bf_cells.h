@@ -19,7 +19,11 @@
 #ifndef _H_BF_CELLS
 #define _H_BF_CELLS
 
+#include "bf_inline.h"
+
+#include <algorithm>
 #include <vector>
+#include <cstddef>
 
 namespace detail {
 
@@ -29,6 +33,42 @@ inline unsigned int growth_factor()
         return 1000;
 }
 
+//! Index of the cell the pc starts at. Storages that can extend to the left
+//  specialize this to start further in.
+template<typename S> struct tape_origin {
+        static std::size_t value() { return 0; }
+};
+
+//! How far from the pc a single instruction may move it or reach a cell. Storages
+//  that are bounded by guard pages rather than checks specialize this to stay
+//  within the guard.
+const std::size_t unlimited_reach = std::size_t(-1);
+
+template<typename S> struct tape_reach {
+        static const std::size_t value = unlimited_reach;
+};
+
+struct io_t;
+
+//! Told the output of a run on the tape while it runs and 0 once it's over.
+//  Storages whose faults end the process from a signal handler specialize this,
+//  to write out what the run has buffered before they report.
+template<typename S> struct tape_output {
+        static void watch(io_t*) {}
+};
+
+//! Watches io for the lifetime of a run on tape S.
+template<typename S> struct watched_output_t {
+        explicit watched_output_t(io_t& io) { tape_output<S>::watch(&io); }
+        ~watched_output_t() { tape_output<S>::watch(0); }
+};
+
+//! Whether the cells lie one after another from data() on, as native code needs
+//  them to. Storages that aren't in one piece specialize this to false.
+template<typename S> struct tape_contiguous {
+        static const bool value = true;
+};
+
 //! Cells - a wrapper that facilitates automatic growth.
 //  the cell storage type requires operator [], value_type, ::resize(), and ::size()
 template<typename S = std::vector<unsigned char> > struct cells_t {
@@ -39,13 +79,17 @@ template<typename S = std::vector<unsigned char> > struct cells_t {
         typename S::value_type const& operator [](unsigned int index) const;
 
         std::size_t size() const;
+        void reset();                          // every cell back to its initial value
+
+        typename S::value_type*       data();
+        typename S::value_type const* data() const;
 
 private:
         mutable S cells_;
         typename S::value_type initial_;
 };
 
-template<typename S> inline typename S::value_type& cells_t<S>::operator [](unsigned int index)
+template<typename S> BF_ALWAYS_INLINE typename S::value_type& cells_t<S>::operator [](unsigned int index)
 {
         typename S::size_type size = cells_.size();
 
@@ -55,7 +99,7 @@ template<typename S> inline typename S::value_type& cells_t<S>::operator [](unsi
         return cells_[index];
 }
 
-template<typename S> inline typename S::value_type const& cells_t<S>::operator [](unsigned int index) const
+template<typename S> BF_ALWAYS_INLINE typename S::value_type const& cells_t<S>::operator [](unsigned int index) const
 {
         typename S::size_type size = cells_.size();
 
@@ -70,6 +114,34 @@ template<typename S> inline std::size_t cells_t<S>::size() const
         return cells_.size();
 }
 
+template<typename S> inline void cells_t<S>::reset()
+{
+        std::fill(cells_.begin(), cells_.end(), initial_);
+}
+
+template<typename S> inline typename S::value_type* cells_t<S>::data()
+{
+        return &cells_[0];
+}
+
+template<typename S> inline typename S::value_type const* cells_t<S>::data() const
+{
+        return &cells_[0];
+}
+
+//! One past the last cell that isn't zero - how far the program got writing to the
+//  tape, as its state is shown. Storages that can tell without reading every cell
+//  overload this.
+template<typename S> std::size_t written_extent(const cells_t<S>& cells)
+{
+        std::size_t size = cells.size();
+
+        while (size != 0 && cells[static_cast<unsigned int>(size - 1)] == 0)
+                --size;
+
+        return size;
+}
+
 } // namespace detail
 
 #endif /* _H_BF_CELLS */
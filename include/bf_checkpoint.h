@@ -0,0 +1,500 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_CHECKPOINT
+#define _H_BF_CHECKPOINT
+
+#include "bf_threaded.h"
+#include "bf_cache.h"
+#include "bf_bytecode.h"
+#include "bf_prefix.h"
+#include "bf_state.h"
+#include "bf_io.h"
+
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+namespace detail {
+
+const uint32_t checkpoint_version = 2;
+const std::size_t checkpoint_page_bytes = 4096;
+const char checkpoint_magic[8] = { 'B', 'F', 'C', 'K', 'P', 'T', 0, 0 };
+
+//! A checkpoint is this header, then the tape from the origin on at a page aligned
+//  offset. Pages of zero cells are never written, the file has holes there, so a
+//  mostly empty tape takes up, and costs to save and load, only what is in use.
+struct checkpoint_header_t {
+        char magic[8];
+        uint32_t header_bytes;               // catches layout changes the version missed
+        uint32_t version;
+        cache_key_t key;                     // the program and the options it was compiled with
+        uint32_t eof;
+        uint32_t position;                   // in the source, of the '[' or ',' to carry on from
+        uint64_t pointer;                    // the pc, from the origin
+        uint64_t cells;                      // up to the last one that isn't zero
+        uint64_t consumed;                   // input bytes the program had read
+        uint64_t produced;                   // output bytes it had written
+        uint64_t output_device;              // the regular file standard output went to, if any
+        uint64_t output_inode;
+        int64_t output_origin;               // where in it the first byte of output is, or would be
+        uint64_t tape_offset;
+};
+
+//! Thrown from a back-edge once the checkpoint that a signal asked for is written.
+struct checkpoint_stop_t : std::runtime_error {
+        explicit checkpoint_stop_t(int signal) : std::runtime_error("stopped by a signal"), signal(signal) {
+        }
+
+        int signal;
+};
+
+//! Thrown from a read that a signal to stop interrupted - the checkpoint is written
+//  where it is caught, at the ',' that was waiting.
+struct checkpoint_interrupted_t : std::runtime_error {
+        checkpoint_interrupted_t() : std::runtime_error("interrupted while reading input") {
+        }
+};
+
+//! Set by the signal handlers and looked at on every back-edge: whether a checkpoint
+//  is due, and the signal to exit with once it is written, if any.
+inline volatile sig_atomic_t& checkpoint_due()
+{
+        static volatile sig_atomic_t due = 0;
+        return due;
+}
+
+inline volatile sig_atomic_t& checkpoint_stop()
+{
+        static volatile sig_atomic_t stop = 0;
+        return stop;
+}
+
+inline void checkpoint_on_signal(int signal)
+{
+        if (signal != SIGALRM)
+                checkpoint_stop() = signal;
+
+        checkpoint_due() = 1;
+}
+
+//! SIGTERM and SIGINT checkpoint and stop, SIGALRM - every interval seconds, unless
+//  it is 0 - checkpoints and carries on. System calls aren't restarted, so that a
+//  read waiting for input sees the signal, see checkpoint_source_t.
+inline void install_checkpoint_handlers(unsigned int interval)
+{
+        struct sigaction action;
+
+        std::memset(&action, 0, sizeof action);
+        action.sa_handler = checkpoint_on_signal;
+        action.sa_flags = 0;
+        sigemptyset(&action.sa_mask);
+
+        sigaction(SIGTERM, &action, 0);
+        sigaction(SIGINT, &action, 0);
+
+        if (interval == 0)
+                return;
+
+        struct itimerval timer;
+
+        std::memset(&timer, 0, sizeof timer);
+        timer.it_interval.tv_sec = timer.it_value.tv_sec = interval;
+
+        sigaction(SIGALRM, &action, 0);
+        setitimer(ITIMER_REAL, &timer, 0);
+}
+
+//! Standard input of a checkpointed run. A program waiting for input takes no
+//  back-edges, so a signal to stop gives up the read instead - one that only asks
+//  for a checkpoint leaves it to the next back-edge.
+struct checkpoint_source_t : source_t {
+        std::size_t read(char* data, std::size_t size);
+};
+
+inline std::size_t checkpoint_source_t::read(char* data, std::size_t size)
+{
+        for (;;) {
+                if (checkpoint_stop())
+                        throw checkpoint_interrupted_t();
+
+                ssize_t result = ::read(STDIN_FILENO, data, size);
+
+                if (result < 0 && errno == EINTR)
+                        continue;
+
+                return result < 0 ? 0 : result;
+        }
+}
+
+inline bool write_fully(int fd, const char* data, std::size_t size, off_t offset)
+{
+        while (size != 0) {
+                ssize_t result = pwrite(fd, data, size, offset);
+
+                if (result < 0 && errno == EINTR)
+                        continue;
+
+                if (result <= 0)
+                        return false;
+
+                data += result;
+                size -= result;
+                offset += result;
+        }
+
+        return true;
+}
+
+inline bool read_fully(int fd, char* data, std::size_t size, off_t offset)
+{
+        while (size != 0) {
+                ssize_t result = pread(fd, data, size, offset);
+
+                if (result < 0 && errno == EINTR)
+                        continue;
+
+                if (result <= 0)
+                        return false;
+
+                data += result;
+                size -= result;
+                offset += result;
+        }
+
+        return true;
+}
+
+inline bool zero_page(const char* data, std::size_t size)
+{
+        static const char zero[checkpoint_page_bytes] = { 0 };
+
+        return !std::memcmp(data, zero, size);
+}
+
+//! Writes the tape of state after header to a temporary file, page by page, and
+//  renames it over path, so that a checkpoint is replaced whole or not at all.
+template<typename C, typename P>
+void write_checkpoint(const std::string& path, checkpoint_header_t header, state_t<unsigned int, std::vector<C>, P>& state)
+{
+        const C* cells = state.data();
+        std::size_t count = state.cell_count();
+
+        while (count != 0 && cells[count - 1] == 0)
+                --count;
+
+        header.pointer     = state.pc();
+        header.cells       = count;
+        header.tape_offset = checkpoint_page_bytes;
+
+        const char* tape = reinterpret_cast<const char*>(cells);
+        std::size_t bytes = count * sizeof(C);
+        std::string temporary = path + ".XXXXXX";
+        int fd = mkstemp(&temporary[0]);
+
+        if (fd < 0)
+                throw std::runtime_error("can't write checkpoint");
+
+        bool written = ftruncate(fd, header.tape_offset + bytes) == 0 &&
+                write_fully(fd, reinterpret_cast<const char*>(&header), sizeof header, 0);
+
+        //! Runs of pages that aren't all zero go out in one write each.
+        for (std::size_t page = 0; written && page < bytes; ) {
+                std::size_t end = page;
+
+                while (end < bytes && !zero_page(tape + end, std::min(checkpoint_page_bytes, bytes - end)))
+                        end += std::min(checkpoint_page_bytes, bytes - end);
+
+                if (end != page)
+                        written = write_fully(fd, tape + page, end - page, header.tape_offset + page);
+
+                page = end == page ? page + checkpoint_page_bytes : end;
+        }
+
+        written = written && fsync(fd) == 0;
+
+        if (close(fd) != 0 || !written || rename(temporary.c_str(), path.c_str()) != 0) {
+                unlink(temporary.c_str());
+                throw std::runtime_error("can't write checkpoint");
+        }
+}
+
+//! Reads a checkpoint of the program with key, run with eof, into header and the
+//  image and pointer of prefix. Only the parts of the file that hold data are read,
+//  the holes are left as the zero cells they stand for.
+template<typename C>
+void read_checkpoint(const std::string& path, const cache_key_t& key, eof_t eof, checkpoint_header_t& header, prefix_t<C>& prefix)
+{
+        int fd = open(path.c_str(), O_RDONLY);
+        struct stat status;
+
+        if (fd < 0 || fstat(fd, &status) != 0 || !read_fully(fd, reinterpret_cast<char*>(&header), sizeof header, 0)) {
+                if (fd >= 0)
+                        close(fd);
+                throw std::runtime_error("can't read checkpoint");
+        }
+
+        uint64_t bytes = header.cells * sizeof(C);
+
+        if (std::memcmp(header.magic, checkpoint_magic, sizeof header.magic) || header.header_bytes != sizeof header ||
+            header.version != checkpoint_version || header.tape_offset < sizeof header ||
+            header.cells > uint64_t(status.st_size) || uint64_t(status.st_size) < header.tape_offset + bytes) {
+                close(fd);
+                throw std::runtime_error("not a checkpoint");
+        }
+
+        if (std::memcmp(&header.key, &key, sizeof key) || header.eof != uint32_t(eof)) {
+                close(fd);
+                throw std::runtime_error("checkpoint is of another program or other options");
+        }
+
+        prefix.image.assign(header.cells, 0);
+        prefix.pointer = header.pointer;
+        prefix.output.clear();
+
+        char* tape = reinterpret_cast<char*>(prefix.image.data());
+        off_t end = header.tape_offset + bytes;
+        bool valid = true;
+
+        for (off_t offset = header.tape_offset; valid && offset < end; ) {
+                off_t data = lseek(fd, offset, SEEK_DATA);
+
+                //! No more data, the rest is a hole. Should holes be unsupported, it is
+                //  all data.
+                if (data < 0 && errno == ENXIO)
+                        break;
+                if (data < 0)
+                        data = offset;
+                if (data >= end)
+                        break;
+
+                off_t hole = lseek(fd, data, SEEK_HOLE);
+
+                if (hole < 0 || hole > end)
+                        hole = end;
+
+                valid = read_fully(fd, tape + (data - header.tape_offset), hole - data, data);
+                offset = hole;
+        }
+
+        close(fd);
+
+        if (!valid)
+                throw std::runtime_error("can't read checkpoint");
+}
+
+//! Lines standard output up with header. When it is the regular file the output of
+//  the checkpointed run went to, and that holds all of it, whatever follows - written
+//  after the checkpoint, and about to be written again - is cut off. Otherwise it is
+//  taken as the file the output goes to from here on.
+inline void reconcile_output(checkpoint_header_t& header)
+{
+        struct stat status;
+
+        if (fstat(STDOUT_FILENO, &status) != 0 || !S_ISREG(status.st_mode)) {
+                header.output_device = header.output_inode = 0;
+                header.output_origin = 0;
+                return;
+        }
+
+        int64_t end = header.output_origin + int64_t(header.produced);
+
+        if (header.output_device == uint64_t(status.st_dev) && header.output_inode == uint64_t(status.st_ino) &&
+            header.output_origin >= 0 && end <= int64_t(status.st_size)) {
+                if (end != int64_t(status.st_size) && ftruncate(STDOUT_FILENO, end) != 0)
+                        throw std::runtime_error("can't cut output back to the checkpoint");
+                lseek(STDOUT_FILENO, end, SEEK_SET);
+                return;
+        }
+
+        int flags = fcntl(STDOUT_FILENO, F_GETFL);
+        off_t at = flags >= 0 && (flags & O_APPEND) ? status.st_size : lseek(STDOUT_FILENO, 0, SEEK_CUR);
+
+        header.output_device = status.st_dev;
+        header.output_inode  = status.st_ino;
+        header.output_origin = int64_t(at < 0 ? 0 : at) - int64_t(header.produced);
+}
+
+//! A tier that promotes nothing, but writes a checkpoint on the back-edge after
+//  a signal asked for one. hot is given the loop's '[', which is where a resumed run
+//  carries on - the state is the same there as just before the jump. It is saved by
+//  its place in the source, the bytecode of a fresh run has its prefix folded away.
+//  save also takes a ',' that a signal to stop interrupted, nothing of it has run.
+template<typename C, typename P> struct checkpoint_tier_t {
+        static const bool enabled = true;
+
+        checkpoint_tier_t(const std::string& path, const checkpoint_header_t& header, state_t<unsigned int, std::vector<C>, P>& state, io_t& io)
+                : path_(path), header_(header), state_(state), io_(io), positions_(0) {
+        }
+
+        void reset(const bytecode_t& bytecode) { positions_ = &bytecode.positions; }
+        bool hot(std::size_t loop) {
+                if (checkpoint_due())
+                        save(loop);
+                return false;
+        }
+
+        int promote(const bytecode_t&, std::size_t, bool) { return 0; }
+
+        template<typename T, typename S, typename Q, typename B> const char* run(int, state_t<T, S, Q>&, io_t&, B&, std::size_t& next) {
+                next = 0;
+                return 0;
+        }
+
+        void save(std::size_t at);
+
+private:
+        std::string path_;
+        checkpoint_header_t header_;         // what the run started from
+        state_t<unsigned int, std::vector<C>, P>& state_;
+        io_t& io_;
+        const std::vector<unsigned int>* positions_;
+};
+
+template<typename C, typename P> void checkpoint_tier_t<C, P>::save(std::size_t at)
+{
+        checkpoint_due() = 0;
+        io_.flush();
+
+        checkpoint_header_t header = header_;
+
+        header.position    = (*positions_)[at];
+        header.consumed    = io_.consumed();
+        header.produced    = header_.produced + io_.produced();
+
+        write_checkpoint(path_, header, state_);
+
+        if (checkpoint_stop())
+                throw checkpoint_stop_t(checkpoint_stop());
+}
+
+} // namespace detail
+
+//! Evaluates the program with the threaded interpreter on standard input and output,
+//  writing a checkpoint to checkpoint - if not empty - when SIGTERM or SIGINT arrives,
+//  after which it exits with 128 plus the signal, and every interval seconds. With
+//  resume, the run carries on from the checkpoint there instead of the start: the
+//  input it had read is skipped, so it has to be the same, and output follows on
+//  from what it had written - in the same file, past whatever came after it.
+template<typename C, typename P>
+int evaluate_checkpointed(const char* program, size_t program_size, bool ignore_unknowns, detail::flush_t flush, detail::eof_t eof,
+                          const std::string& checkpoint, unsigned int interval, const std::string& resume)
+{
+        detail::checkpoint_source_t input;
+        detail::fd_sink_t output(STDOUT_FILENO);
+        detail::io_t io(input, output, flush, eof);
+
+        detail::bytecode_t bytecode;
+
+        try {
+                detail::compile(program, program_size, ignore_unknowns, bytecode, P::wraps);
+        }
+        catch (detail::syntax_error& e) {
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        detail::checkpoint_header_t header;
+        detail::prefix_t<C> prefix;
+        std::size_t at = 0;
+
+        std::memset(&header, 0, sizeof header);
+        std::memcpy(header.magic, detail::checkpoint_magic, sizeof header.magic);
+        header.header_bytes = sizeof header;
+        header.version      = detail::checkpoint_version;
+        header.key          = detail::cache_key<C, P>(program, program_size, ignore_unknowns);
+        header.eof          = eof;
+
+        if (resume.empty())
+                detail::fold_prefix<C, P>(bytecode, prefix);
+        else {
+                detail::cache_key_t key = header.key;
+
+                try {
+                        detail::read_checkpoint<C>(resume, key, eof, header, prefix);
+                }
+                catch (std::runtime_error& e) {
+                        std::cout<<resume<<": "<<e.what()<<std::endl;
+                        return EXIT_FAILURE;
+                }
+
+                while (at != bytecode.code.size() && ((bytecode.code[at].opcode != detail::OP_Open && bytecode.code[at].opcode != detail::OP_Input) ||
+                                                      bytecode.positions[at] != header.position))
+                        ++at;
+
+                if (at == bytecode.code.size()) {
+                        std::cout<<resume<<": checkpoint is of another program or other options"<<std::endl;
+                        return EXIT_FAILURE;
+                }
+
+                io.skip(header.consumed);
+        }
+
+        try {
+                detail::reconcile_output(header);
+        }
+        catch (std::runtime_error& e) {
+                std::cout<<resume<<": "<<e.what()<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if (!checkpoint.empty())
+                detail::install_checkpoint_handlers(interval);
+
+        detail::state_t<unsigned int, std::vector<C>, P> state;
+        detail::checkpoint_tier_t<C, P> tier(checkpoint, header, state, io);
+        detail::no_recorder_t recorder;
+        std::vector<detail::threaded_t> code;
+
+        try {
+                detail::run_threaded<C>(bytecode, prefix, state, io, recorder, tier, code, at);
+        }
+        catch (detail::checkpoint_stop_t& e) {
+                return 128 + e.signal;
+        }
+        catch (detail::checkpoint_interrupted_t&) {
+                try {
+                        tier.save(at);
+                }
+                catch (detail::checkpoint_stop_t& e) {
+                        return 128 + e.signal;
+                }
+                catch (std::runtime_error& e) {
+                        return detail::display_error_cause(e.what(), program, program_size, bytecode.positions[at]);
+                }
+        }
+        catch (std::runtime_error& e) {
+                return detail::display_error_cause(e.what(), program, program_size, bytecode.positions[at]);
+        }
+
+        return EXIT_SUCCESS;
+}
+
+#endif /* _H_BF_CHECKPOINT */
\ No newline at end of file
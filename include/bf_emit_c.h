@@ -0,0 +1,350 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_EMIT_C
+#define _H_BF_EMIT_C
+
+#include "bf_evaluate.h"
+#include "bf_bytecode.h"
+#include "bf_io.h"
+#include "bf_prefix.h"
+
+#include <type_traits>
+#include <ostream>
+#include <string>
+#include <limits>
+#include <cstdlib>
+
+namespace detail {
+
+//! Name of the C type with the same width and signedness as C.
+template<typename C> const char* c_type_name(bool want_unsigned = false)
+{
+        bool is_signed = std::numeric_limits<C>::is_signed && !want_unsigned;
+
+        switch (sizeof(C)) {
+        case 1:  return is_signed ? "signed char" : "unsigned char";
+        case 2:  return is_signed ? "short"       : "unsigned short";
+        case 4:  return is_signed ? "int"         : "unsigned int";
+        }
+
+        return is_signed ? "long long" : "unsigned long long";
+}
+
+//! Runtime support of the generated program: a growing tape and a user space
+//  output buffer, flushed like FLUSH_LINES and FLUSH_INPUT say and at exit. Only
+//  the helpers the program calls are written, the rest would be unused statics.
+inline void c_prologue(std::ostream& out, bool writes, bool writes_text, bool reads)
+{
+        out<<
+                "#include <stdio.h>\n"
+                "#include <stdlib.h>\n"
+                "#include <string.h>\n"
+                "\n"
+                "static cell_t* tape;\n"
+                "static size_t  tape_size = 65536 - LOWEST;\n"
+                "static cell_t* low;\n"
+                "static cell_t* high;\n"
+                "\n"
+                "static unsigned char output[1 << 16];\n"
+                "static size_t        output_used;\n"
+                "\n"
+                "static void flush_output(void)\n"
+                "{\n"
+                "        fwrite(output, 1, output_used, stdout);\n"
+                "        fflush(stdout);\n"
+                "        output_used = 0;\n"
+                "}\n"
+                "\n";
+
+        if (writes || writes_text)
+                out<<
+                "static void put(cell_t value, unsigned int count)\n"
+                "{\n"
+                "        while (count--) {\n"
+                "                if (output_used == sizeof output)\n"
+                "                        flush_output();\n"
+                "                output[output_used++] = (unsigned char)value;\n"
+                "                if (FLUSH_LINES && (unsigned char)value == '\\n')\n"
+                "                        flush_output();\n"
+                "        }\n"
+                "}\n"
+                "\n";
+
+        if (writes_text)
+                out<<
+                "static void put_text(const char* text, unsigned int size)\n"
+                "{\n"
+                "        while (size--)\n"
+                "                put((cell_t)(unsigned char)*text++, 1);\n"
+                "}\n"
+                "\n";
+
+        if (reads)
+                out<<
+                "static cell_t get(cell_t current)\n"
+                "{\n"
+                "        int value;\n"
+                "\n"
+                "        if (FLUSH_INPUT)\n"
+                "                flush_output();\n"
+                "        value = getchar();\n"
+                "        (void)current;\n"
+                "\n"
+                "        return value == EOF ? (cell_t)(END_OF_INPUT) : (cell_t)value;\n"
+                "}\n"
+                "\n";
+
+        out<<
+                "static void bind(void)\n"
+                "{\n"
+                "        low  = tape - LOWEST;      /* cells left of it are padding for negative offsets */\n"
+                "        high = tape + tape_size - HIGHEST;\n"
+                "}\n"
+                "\n"
+                "static cell_t* check(cell_t* p)\n"
+                "{\n"
+                "        size_t position;\n"
+                "\n"
+                "        if (p < low) {\n"
+                "                flush_output();\n"
+                "                fputs(\"Error: pc underflow\\n\", stderr);\n"
+                "                exit(EXIT_FAILURE);\n"
+                "        }\n"
+                "\n"
+                "        position = p - tape;\n"
+                "\n"
+                "        if (p >= high) {\n"
+                "                size_t size = position + HIGHEST + 1000;\n"
+                "\n"
+                "                if (!(tape = realloc(tape, size * sizeof *tape))) {\n"
+                "                        fputs(\"Error: out of memory\\n\", stderr);\n"
+                "                        exit(EXIT_FAILURE);\n"
+                "                }\n"
+                "\n"
+                "                memset(tape + tape_size, 0, (size - tape_size) * sizeof *tape);\n"
+                "                tape_size = size;\n"
+                "                bind();\n"
+                "        }\n"
+                "\n"
+                "        return tape + position;\n"
+                "}\n"
+                "\n"
+                "#define ADD(k, n)     p[k] = (cell_t)((ucell_t)p[k] + (ucell_t)(n))\n"
+                "#define MULADD(k, n)  p[k] = (cell_t)(ucell_t)((unsigned long long)(ucell_t)p[k] + (unsigned long long)(ucell_t)p[0] * (ucell_t)(n))\n"
+                "#define MOVE(n)       do { p += (n); if (p < low || p >= high) p = check(p); } while (0)\n"
+                "#define REACH(k)      do { if (p + (k) < low) check(p + (k)); } while (0)\n"
+                "\n"
+                "int main(void)\n"
+                "{\n"
+                "        cell_t* p;\n"
+                "\n"
+                "        tape = calloc(tape_size, sizeof *tape);\n"
+                "        bind();\n"
+                "        p = check(tape - LOWEST);\n"
+                "\n";
+}
+
+//! Whether any instruction of the bytecode is an opcode.
+inline bool uses_opcode(const bytecode_t& bytecode, opcode_t opcode)
+{
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i)
+                if (bytecode.code[i].opcode == opcode)
+                        return true;
+
+        return false;
+}
+
+inline std::string c_indent(unsigned int depth)
+{
+        return std::string(8 * (depth + 1), ' ');
+}
+
+//! What the generated get() returns at the end of input.
+inline const char* c_end_of_input(eof_t eof)
+{
+        switch (eof) {
+        case EOF_Zero:      return "0";
+        case EOF_Unchanged: return "current";
+        case EOF_MinusOne:  break;
+        }
+
+        return "-1";
+}
+
+//! Text as a C string literal, anything but printable ASCII as an octal escape.
+inline std::string c_string_literal(const std::string& text)
+{
+        static const char digits[] = "01234567";
+        std::string literal(1, '"');
+
+        for (std::size_t i = 0; i != text.size(); ++i) {
+                unsigned char c = static_cast<unsigned char>(text[i]);
+
+                if (c >= ' ' && c <= '~' && c != '"' && c != '\\' && c != '?') {
+                        literal += static_cast<char>(c);
+                        continue;
+                }
+
+                literal += '\\';
+                literal += digits[c >> 6];
+                literal += digits[(c >> 3) & 7];
+                literal += digits[c & 7];
+        }
+
+        return literal + '"';
+}
+
+//! Statements that put the tape and output where the folded prefix left them.
+template<typename C>
+void emit_c_prefix(const prefix_t<C>& prefix, std::ostream& out)
+{
+        typedef typename std::make_unsigned<C>::type U;
+
+        if (!prefix.image.empty()) {
+                out<<"        {\n"
+                   <<"                static const ucell_t image[] = {";
+
+                for (std::size_t i = 0; i != prefix.image.size(); ++i)
+                        out<<(i % 8 ? " " : "\n                        ")<<static_cast<unsigned long long>(static_cast<U>(prefix.image[i]))<<"ull,";
+
+                out<<"\n                };\n"
+                   <<"\n"
+                   <<"                p = check(p + sizeof image / sizeof *image) - sizeof image / sizeof *image;\n"
+                   <<"                memcpy(p, image, sizeof image);\n"
+                   <<"        }\n";
+        }
+
+        if (prefix.pointer != 0)
+                out<<"        MOVE("<<prefix.pointer<<");\n";
+
+        for (std::size_t i = 0; i < prefix.output.size(); i += 64)
+                out<<"        put_text("<<c_string_literal(prefix.output.substr(i, 64))<<", "<<prefix.output.substr(i, 64).size()<<");\n";
+
+        out<<"\n";
+}
+
+//! Writes a standalone C translation unit equivalent to the bytecode, started from
+//  where prefix left off. Cells wrap around like they do in the native engine.
+template<typename C>
+void emit_c(const bytecode_t& bytecode, const prefix_t<C>& prefix, std::ostream& out, flush_t flush = FLUSH_Block, eof_t eof = EOF_MinusOne)
+{
+        int lowest, highest;
+        unsigned int depth = 0;
+        int reached = 0;
+
+        offset_range(bytecode, lowest, highest);
+
+        out<<"/* Generated by bf. */\n"
+           <<"typedef "<<c_type_name<C>()<<" cell_t;\n"
+           <<"typedef "<<c_type_name<C>(true)<<" ucell_t;\n"
+           <<"\n"
+           <<"#define LOWEST  "<<lowest<<"\n"
+           <<"#define HIGHEST "<<highest<<"\n"
+           <<"\n"
+           <<"#define FLUSH_LINES  "<<(flush == FLUSH_Line)<<"\n"
+           <<"#define FLUSH_INPUT  "<<(flush != FLUSH_Never)<<"\n"
+           <<"#define END_OF_INPUT "<<c_end_of_input(eof)<<"\n"
+           <<"\n";
+
+        c_prologue(out, uses_opcode(bytecode, OP_Output), !prefix.output.empty(), uses_opcode(bytecode, OP_Input));
+
+        emit_c_prefix(prefix, out);
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i) {
+                const instruction_t& instruction = bytecode.code[i];
+
+                //! Moves are put off within a block, a cell left of the pc has to be
+                //  checked before it's accessed - as in the native engine, multiply-adds
+                //  aren't.
+                if (!addresses_cell(instruction.opcode))
+                        reached = 0;
+                else if (instruction.opcode != OP_MulAdd && instruction.offset < reached) {
+                        out<<c_indent(depth)<<"REACH("<<instruction.offset<<");\n";
+                        reached = instruction.offset;
+                }
+
+                switch (instruction.opcode) {
+                case OP_Add:
+                        out<<c_indent(depth)<<"ADD("<<instruction.offset<<", "<<instruction.operand<<");\n";
+                        break;
+                case OP_Move:
+                        out<<c_indent(depth)<<"MOVE("<<instruction.operand<<");\n";
+                        break;
+                case OP_Output:
+                        out<<c_indent(depth)<<"put(p["<<instruction.offset<<"], "<<instruction.operand<<");\n";
+                        break;
+                case OP_Input:
+                        out<<c_indent(depth)<<"p["<<instruction.offset<<"] = get(p["<<instruction.offset<<"]);\n";
+                        break;
+                case OP_Open:
+                        out<<c_indent(depth++)<<"while (p[0]) {\n";
+                        break;
+                case OP_Close:
+                        out<<c_indent(--depth)<<"}\n";
+                        break;
+                case OP_Clear:
+                        out<<c_indent(depth)<<"p["<<instruction.offset<<"] = 0;\n";
+                        break;
+                case OP_MulAdd:
+                        out<<c_indent(depth)<<"MULADD("<<instruction.offset<<", "<<instruction.operand<<");\n";
+                        break;
+                case OP_Scan:
+                        out<<c_indent(depth)<<"while (p[0])\n"<<c_indent(depth + 1)<<"MOVE("<<instruction.operand<<");\n";
+                        break;
+                case OP_Set:
+                        out<<c_indent(depth)<<"p["<<instruction.offset<<"] = "<<instruction.operand<<";\n";
+                        break;
+                case OP_Halt:
+                        break;
+                }
+        }
+
+        out<<"\n"
+           <<"        flush_output();\n"
+           <<"        return EXIT_SUCCESS;\n"
+           <<"}\n";
+}
+
+} // namespace detail
+
+//! Compiles the program and writes it out as C instead of evaluating it. The start of
+//  the program that doesn't depend on input is run here, the C code begins with
+//  its result.
+template<typename C>
+int translate_to_c(const char* program, size_t program_size, bool ignore_unknowns, std::ostream& out,
+                   detail::flush_t flush = detail::FLUSH_Block, detail::eof_t eof = detail::EOF_MinusOne)
+{
+        detail::bytecode_t bytecode;
+
+        try {
+                detail::compile(program, program_size, ignore_unknowns, bytecode);
+        }
+        catch (detail::syntax_error& e) {
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        detail::prefix_t<C> prefix;
+
+        detail::fold_prefix<C, detail::wrap_policy_t>(bytecode, prefix);
+        detail::emit_c<C>(bytecode, prefix, out, flush, eof);
+
+        return EXIT_SUCCESS;
+}
+
+#endif /* _H_BF_EMIT_C */
\ No newline at end of file
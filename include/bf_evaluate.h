@@ -21,48 +21,250 @@
 
 #include "bf_state.h"
 #include "bf_optimize.h"
+#include "bf_io.h"
+#include "bf_syntax.h"
+#include "bf_bytecode.h"
+#include "bf_profile.h"
+#include "bf_prefix.h"
+#include "bf_budget.h"
 
+#include <type_traits>
 #include <stdexcept>
 #include <iostream>
 #include <iomanip>
+#include <vector>
 #include <cstdlib>
 
-#include <cstdio>
-
 namespace detail {
 
-inline int display_error_cause(const char* message, const char* program, unsigned int command_index)
+//! How much of a line is shown on either side of the command that caused an error.
+const std::size_t error_context = 64;
+
+//! Display error and, for each command that caused it, where it is. The commands are
+//  in source order so the lines are counted in a single pass.
+inline int display_error_cause(std::ostream& out, const char* message, const char* program, size_t program_size, const std::vector<unsigned int>& commands)
 {
-        //! Display error and what caused it.
-        std::cout<<"Error: "<<message<<", cause:"<<std::endl
-                 <<program<<std::endl<<std::setfill(' ')<<std::setw(command_index)<<'^'<<std::endl;
+        out<<"Error: "<<message<<", cause:"<<std::endl;
+
+        unsigned int line = 1;
+        std::size_t line_start = 0;
+        std::size_t scanned = 0;
+
+        for (std::size_t i = 0; i != commands.size(); ++i) {
+                std::size_t command_index = commands[i];
+
+                for (; scanned < command_index && scanned != program_size; ++scanned) {
+                        if (program[scanned] == '\n') {
+                                ++line;
+                                line_start = scanned + 1;
+                        }
+                }
+
+                std::size_t line_end = command_index;
 
-        std::cout<<"Instruction #"<<command_index<<std::endl;
+                while (line_end < program_size && line_end - command_index < error_context && program[line_end] != '\n')
+                        ++line_end;
+
+                std::size_t shown = command_index - line_start > error_context ? command_index - error_context : line_start;
+
+                out.write(program + shown, line_end - shown);
+                out<<std::endl<<std::setfill(' ')<<std::setw(command_index - shown + 1)<<'^'<<std::endl;
+
+                out<<"Instruction #"<<command_index<<", line "<<line<<", column "<<command_index - line_start + 1<<std::endl;
+        }
 
         return EXIT_FAILURE;
 }
 
+inline int display_error_cause(const char* message, const char* program, size_t program_size, const std::vector<unsigned int>& commands)
+{
+        return display_error_cause(std::cout, message, program, program_size, commands);
+}
+
+inline int display_error_cause(const char* message, const char* program, size_t program_size, unsigned int command_index)
+{
+        return display_error_cause(message, program, program_size, std::vector<unsigned int>(1, command_index));
+}
+
+//! As display_error_cause for a run that reached a limit of its budget, followed by
+//  the state it was in. Returns budget_exit_status.
+template<typename C, typename F>
+int display_limit_reached(std::ostream& out, const budget_t& budget, const char* program, size_t program_size, unsigned int command_index,
+                          F cell, std::size_t count, std::size_t pointer)
+{
+        display_error_cause(out, budget.reached(), program, program_size, std::vector<unsigned int>(1, command_index));
+        display_budget_state<C>(out, budget, cell, count, pointer);
+
+        return budget_exit_status;
+}
+
+template<typename C, typename F>
+int display_limit_reached(const budget_t& budget, const char* program, size_t program_size, unsigned int command_index,
+                          F cell, std::size_t count, std::size_t pointer)
+{
+        return display_limit_reached<C>(std::cout, budget, program, program_size, command_index, cell, count, pointer);
+}
+
+template<typename T, typename S, typename P>
+int display_limit_reached(std::ostream& out, const budget_t& budget, const char* program, size_t program_size, unsigned int command_index,
+                          const state_t<T, S, P>& state)
+{
+        std::size_t origin = tape_origin<S>::value();
+        std::size_t extent = state.extent();
+
+        return display_limit_reached<typename S::value_type>(out, budget, program, program_size, command_index,
+                                                             [&](std::size_t index) { return state.at(origin + index); },
+                                                             extent > origin ? extent - origin : 0, state.pc() - origin);
+}
+
+template<typename T, typename S, typename P>
+int display_limit_reached(const budget_t& budget, const char* program, size_t program_size, unsigned int command_index,
+                          const state_t<T, S, P>& state)
+{
+        return display_limit_reached(std::cout, budget, program, program_size, command_index, state);
+}
+
+//! No limit is reached without a budget, these only have to compile.
+template<typename C, typename F>
+int display_limit_reached(const no_budget_t&, const char*, size_t, unsigned int, F, std::size_t, std::size_t)
+{
+        return budget_exit_status;
+}
+
+template<typename T, typename S, typename P>
+int display_limit_reached(const no_budget_t&, const char*, size_t, unsigned int, const state_t<T, S, P>&)
+{
+        return budget_exit_status;
+}
+
 } // namespace detail
 
-//! Optimizes and evaluates the program.
-template<typename C>
-int evaluate(const char* program, size_t program_size, bool ignore_unknowns = false)
+namespace detail {
+
+//! Runs what the program does before it reads input ahead of time, see fold_prefix,
+//  and returns the command to carry on from - 0 if nothing could be folded. The
+//  bytecode only stops outside of loops, where the source can be picked up as is.
+//  Its moves aren't put off, the pc has to be where the source expects it.
+template<typename C, typename P>
+unsigned int fold_source_prefix(const char* program, size_t program_size, bool ignore_unknowns, prefix_t<C>& prefix)
+{
+        bytecode_t bytecode;
+
+        try {
+                compile(program, program_size, ignore_unknowns, bytecode, P::wraps, false);
+        }
+        catch (syntax_error&) {
+                //! Reported by the evaluator if it gets that far.
+                return 0;
+        }
+
+        std::size_t size = bytecode.code.size();
+
+        fold_prefix<C, P>(bytecode, prefix);
+
+        return bytecode.code.size() == size ? 0 : bytecode.positions[0];
+}
+
+//! Rejects programs that move past the guard pages of tape S, see check_reach. An
+//  invalid command is only an error once it runs, so they are skipped here.
+template<typename S> void check_source_reach(const char* program, size_t program_size)
+{
+        if (tape_reach<S>::value == unlimited_reach)
+                return;
+
+        bytecode_t bytecode;
+
+        compile(program, program_size, true, bytecode);
+        check_reach(bytecode, tape_reach<S>::value);
+}
+
+//! Marks the '[' of every loop the bytecode keeps - the ones a budget counts. Fused
+//  loops, say "[-]" or "[>]", run as a single instruction there.
+template<typename P> void mark_counted_loops(const char* program, size_t program_size, bool ignore_unknowns, std::vector<char>& counted)
 {
-        detail::state_t<unsigned int, std::vector<C> > state;
-        detail::optimizations_table table(state.cell_count(), 1);
+        bytecode_t bytecode;
 
-        detail::optimize(program, program_size, table);
+        counted.assign(program_size, 0);
 
+        try {
+                compile(program, program_size, ignore_unknowns, bytecode, P::wraps);
+        }
+        catch (syntax_error&) {
+                return;
+        }
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i)
+                if (bytecode.code[i].opcode == OP_Open)
+                        counted[bytecode.positions[i]] = 1;
+}
+
+} // namespace detail
+
+//! Optimizes and evaluates the program. S is the cell storage, P the overflow policy.
+//  The commands are stepped through with whitespace taken out, see command_stream_t.
+//  Each command tells the recorder it ran, which compiles to nothing for no_recorder_t;
+//  without a recorder or a budget the input independent start of the program is
+//  folded. Every back-edge of a loop the bytecode engines keep is spent from the
+//  budget.
+template<typename C, typename S, typename P, typename R, typename B>
+int evaluate(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, B& budget)
+{
+        typedef typename std::make_unsigned<typename S::value_type>::type count_t;
+
+        detail::state_t<unsigned int, S, P> state;
+        detail::command_stream_t stream(program, program_size, ignore_unknowns);
+        const char* commands = stream.commands.data();
+        const unsigned int commands_size = static_cast<unsigned int>(stream.commands.size());
+        const std::vector<unsigned int>& positions = stream.positions;
+        detail::optimizations_table table(commands_size + 1, 1);
+
+        try {
+                detail::optimize(commands, commands_size, table);
+                detail::check_source_reach<S>(program, program_size);
+        }
+        catch (detail::syntax_error& e) {
+                for (std::size_t i = 0; i != e.commands.size(); ++i)
+                        e.commands[i] = positions[e.commands[i]];
+
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        detail::prefix_t<C> prefix;
         unsigned int command_index = 0;
 
+        if (!R::enabled && !B::enabled)
+                command_index = stream.index_of(detail::fold_source_prefix<C, P>(program, program_size, ignore_unknowns, prefix));
+
+        std::vector<char> counted;
+
+        if (B::enabled) {
+                std::vector<char> counted_source;
+
+                detail::mark_counted_loops<P>(program, program_size, ignore_unknowns, counted_source);
+                counted.resize(commands_size);
+
+                for (unsigned int i = 0; i != commands_size; ++i)
+                        counted[i] = counted_source[positions[i]];
+        }
+
+        detail::watched_output_t<S> watched(io);
+
+        recorder.compiled();
+        budget.start();
+
         try {
-                while (command_index != program_size) {
+                detail::restore_prefix(prefix, state, io);
+
+                if (!budget.spend(prefix.steps))
+                        throw detail::budget_exceeded_t(budget.reached());
+
+                while (command_index != commands_size) {
                         int table_value = table[command_index];
 
-                        switch (program[command_index]) {
-                        case ' ':
-                        case '\n':
-                                break;
+                        if (R::enabled && detail::is_command(commands[command_index]))
+                                recorder.executed(positions[command_index]);
+
+                        switch (commands[command_index]) {
                         case '>':
                                 command_index += table_value;
                                 state.increment_pc(table_value);
@@ -80,54 +282,97 @@ int evaluate(const char* program, size_t program_size, bool ignore_unknowns = fa
                                 state.decrement_current_cell(table_value);
                                 continue;
                         case '.':
-                                putchar(state.get());
-                                break;
+                                command_index += table_value;
+                                io.put(state.get(), table_value);
+                                continue;
                         case ',':
-                                state.set() = getchar();
+                                io.get(state.set());
                                 break;
                         case '[':
                                 if (table_value == detail::CC_Clear.table_value) {
-                                        state.set() = 0;
+                                        if (R::enabled)
+                                                recorder.loop(positions[command_index], detail::LOOP_Clear, static_cast<count_t>(state.get()));
+                                        state.clear();
                                         command_index += detail::CC_Clear.command_length;
                                         continue;
                                 }
 
                                 if (table_value == detail::CC_Add.table_value) {
-                                        unsigned int this_cell = state.get();
-                                        unsigned int next_cell;
-
-                                        state.set() = 0;
-                                        state.increment_pc();
-
-                                        next_cell = state.get();
-
-                                        state.set() = this_cell + next_cell;
-                                        state.decrement_pc();
-
+                                        if (R::enabled)
+                                                recorder.loop(positions[command_index], detail::LOOP_MulAdd, static_cast<count_t>(state.get()));
+                                        state.multiply_add(1, 1);
+                                        state.clear();
                                         command_index += detail::CC_Add.command_length;
                                         continue;
                                 }
 
+                                if (R::enabled) {
+                                        recorder.entered(positions[command_index]);
+                                        if (state.get() != 0)
+                                                recorder.iterated(positions[command_index]);
+                                }
+
                                 if (state.get() == 0)
                                         command_index = table_value;
                                 break;
                         case ']':
-                                if (state.get() != 0)
+                                if (R::enabled && state.get() != 0)
+                                        recorder.iterated(positions[table_value]);
+
+                                if (state.get() != 0) {
+                                        if (B::enabled && counted[table_value] && !budget.spend())
+                                                throw detail::budget_exceeded_t(budget.reached());
+
                                         command_index = table_value;
+                                }
                                 break;
                         default:
-                                if (!ignore_unknowns)
-                                        throw std::runtime_error("found an invalid command");
+                                //! Only what can't be skipped is left in the stream.
+                                throw std::runtime_error("found an invalid command");
                         }
 
                         ++command_index;
                 }
+
+                recorder.finished(state.cell_count());
+                io.flush();
+        }
+        catch (detail::budget_exceeded_t&) {
+                recorder.finished(state.cell_count());
+                io.flush_quietly();
+                return detail::display_limit_reached(budget, program, program_size, positions[command_index], state);
         }
         catch (std::runtime_error& e) {
-                return detail::display_error_cause(e.what(), program, command_index);
+                recorder.finished(state.cell_count());
+                io.flush_quietly();
+                return detail::display_error_cause(e.what(), program, program_size, positions[command_index]);
         }
 
         return EXIT_SUCCESS;
 }
 
+template<typename C, typename S, typename P, typename R>
+int evaluate(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder)
+{
+        detail::no_budget_t budget;
+
+        return evaluate<C, S, P>(program, program_size, ignore_unknowns, io, recorder, budget);
+}
+
+template<typename C, typename S, typename P>
+int evaluate(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io)
+{
+        detail::no_recorder_t recorder;
+
+        return evaluate<C, S, P>(program, program_size, ignore_unknowns, io, recorder);
+}
+
+template<typename C>
+int evaluate(const char* program, size_t program_size, bool ignore_unknowns = false)
+{
+        detail::io_t io;
+
+        return evaluate<C, std::vector<C>, detail::wrap_policy_t>(program, program_size, ignore_unknowns, io);
+}
+
 #endif /* _H_BF_EVALUATE */
@@ -0,0 +1,272 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_GUARDED
+#define _H_BF_GUARDED
+
+#include "bf_cells.h"
+#include "bf_io.h"
+
+#include <sys/mman.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <stdexcept>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+namespace detail {
+
+const std::size_t guarded_tape_bytes = std::size_t(1) << 31;    // usable part of the reservation
+const std::size_t guarded_guard_bytes = std::size_t(1) << 20;   // inaccessible on either side
+const std::size_t guarded_commit_bytes = std::size_t(1) << 16;  // granularity of lazy commits
+const std::size_t guarded_max_regions = 64;
+
+//! A reservation as seen by the fault handler.
+struct guarded_region_t {
+        char* begin;                 // first usable byte
+        char* end;                   // one past the last usable byte
+};
+
+inline guarded_region_t* volatile* guarded_regions()
+{
+        static guarded_region_t* volatile regions[guarded_max_regions];
+        return regions;
+}
+
+//! The output of the run on this thread, as the fault handler sees it.
+struct guarded_output_t {
+        int fd;                              // -1 for none
+        const char* data;
+        const std::size_t* size;
+};
+
+inline guarded_output_t& guarded_output()
+{
+        static thread_local guarded_output_t output = { -1, 0, 0 };
+        return output;
+}
+
+inline void guarded_write(int fd, const char* data, std::size_t size)
+{
+        while (size != 0) {
+                ssize_t written = write(fd, data, size);
+
+                if (written < 0 && errno == EINTR)
+                        continue;
+                if (written <= 0)
+                        return;
+
+                data += written;
+                size -= written;
+        }
+}
+
+//! Writes out what the run has buffered, then the error as the interpreters show
+//  it - on stdout - and ends the process. Only async-signal-safe calls from here.
+inline void guarded_report(const char* message)
+{
+        guarded_output_t& output = guarded_output();
+
+        if (output.fd >= 0)
+                guarded_write(output.fd, output.data, *output.size);
+
+        guarded_write(STDOUT_FILENO, message, strlen(message));
+        _exit(EXIT_FAILURE);
+}
+
+//! Commits the chunk around a fault inside a tape, reports a fault in a guard area
+//  and leaves anything else to the default action.
+inline void guarded_fault(int signal, siginfo_t* info, void*)
+{
+        char* address = static_cast<char*>(info->si_addr);
+        guarded_region_t* volatile* regions = guarded_regions();
+
+        for (std::size_t i = 0; i != guarded_max_regions; ++i) {
+                guarded_region_t* region = regions[i];
+
+                if (!region)
+                        continue;
+
+                if (address >= region->begin && address < region->end) {
+                        char* chunk = region->begin + (address - region->begin) / guarded_commit_bytes * guarded_commit_bytes;
+
+                        if (mprotect(chunk, guarded_commit_bytes, PROT_READ | PROT_WRITE) != 0)
+                                guarded_report("Error: can't commit tape memory\n");
+                        return;
+                }
+
+                if (address >= region->begin - guarded_guard_bytes && address < region->begin)
+                        guarded_report("Error: pc underflow\n");
+
+                if (address >= region->end && address < region->end + guarded_guard_bytes)
+                        guarded_report("Error: pc overflow\n");
+        }
+
+        //! Not ours - fault again with the default action.
+        struct sigaction action;
+
+        std::memset(&action, 0, sizeof action);
+        action.sa_handler = SIG_DFL;
+        sigaction(signal, &action, 0);
+}
+
+inline void guarded_install_handler()
+{
+        static bool installed = false;
+
+        if (installed)
+                return;
+
+        struct sigaction action;
+
+        std::memset(&action, 0, sizeof action);
+        action.sa_sigaction = &guarded_fault;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+
+        if (sigaction(SIGSEGV, &action, 0) != 0)
+                throw std::runtime_error("can't install the tape fault handler");
+
+        installed = true;
+}
+
+//! Cell storage backed by one large reservation. Pages are committed by the fault
+//  handler when first touched, so it never needs to grow or be bounds checked.
+//  The pc starts in the middle, leaving as much room to the left as to the right.
+template<typename C> struct guarded_storage_t {
+        typedef C           value_type;
+        typedef std::size_t size_type;
+
+        explicit guarded_storage_t(size_type init_size = 0, C initial = 0);
+        ~guarded_storage_t();
+
+        C&       operator [](size_type index)       { return cells_[index]; }
+        C const& operator [](size_type index) const { return cells_[index]; }
+
+        void resize(size_type, C) {}
+        size_type size() const { return guarded_tape_bytes / sizeof(C); }
+
+        void reset();                        // zeroed again, committed pages are given back
+
+        static size_type origin() { return guarded_tape_bytes / sizeof(C) / 2; }
+
+private:
+        guarded_storage_t(const guarded_storage_t&);
+        guarded_storage_t& operator =(const guarded_storage_t&);
+
+        char* mapping_;
+        C* cells_;
+        guarded_region_t region_;
+};
+
+template<typename C> guarded_storage_t<C>::guarded_storage_t(size_type, C initial) : mapping_(0), cells_(0)
+{
+        if (initial != 0)
+                throw std::runtime_error("guarded tapes start out zeroed");
+
+        guarded_install_handler();
+
+        void* mapping = mmap(0, guarded_tape_bytes + 2 * guarded_guard_bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+        if (mapping == MAP_FAILED)
+                throw std::runtime_error("can't reserve memory for the tape");
+
+        mapping_ = static_cast<char*>(mapping);
+        cells_ = reinterpret_cast<C*>(mapping_ + guarded_guard_bytes);
+
+        region_.begin = mapping_ + guarded_guard_bytes;
+        region_.end   = region_.begin + guarded_tape_bytes;
+
+        guarded_region_t* volatile* regions = guarded_regions();
+
+        for (std::size_t i = 0; i != guarded_max_regions; ++i)
+                if (__sync_bool_compare_and_swap(&regions[i], static_cast<guarded_region_t*>(0), &region_))
+                        return;
+
+        munmap(mapping_, guarded_tape_bytes + 2 * guarded_guard_bytes);
+        throw std::runtime_error("too many guarded tapes");
+}
+
+template<typename C> guarded_storage_t<C>::~guarded_storage_t()
+{
+        guarded_region_t* volatile* regions = guarded_regions();
+
+        for (std::size_t i = 0; i != guarded_max_regions; ++i)
+                __sync_bool_compare_and_swap(&regions[i], &region_, static_cast<guarded_region_t*>(0));
+
+        munmap(mapping_, guarded_tape_bytes + 2 * guarded_guard_bytes);
+}
+
+template<typename C> void guarded_storage_t<C>::reset()
+{
+        //! Private anonymous pages read as zero once dropped, and stay accessible.
+        if (madvise(region_.begin, guarded_tape_bytes, MADV_DONTNEED) != 0)
+                throw std::runtime_error("can't reset the tape");
+}
+
+//! Guarded storage needs no growth, indexing is a plain dereference.
+template<typename C> struct cells_t<guarded_storage_t<C> > {
+        explicit cells_t(unsigned int init_size = 0, C initial = 0) : cells_(init_size, initial) {
+        }
+
+        C&       operator [](unsigned int index)       { return cells_[index]; }
+        C const& operator [](unsigned int index) const { return cells_[index]; }
+
+        std::size_t size() const { return cells_.size(); }
+        void reset() { cells_.reset(); }
+
+        C*       data()       { return &cells_[0]; }
+        C const* data() const { return &cells_[0]; }
+
+private:
+        guarded_storage_t<C> cells_;
+};
+
+//! Reading the tape through would commit every page of it, so all of it counts.
+template<typename C> std::size_t written_extent(const cells_t<guarded_storage_t<C> >& cells)
+{
+        return cells.size();
+}
+
+template<typename C> struct tape_origin<guarded_storage_t<C> > {
+        static std::size_t value() { return guarded_storage_t<C>::origin(); }
+};
+
+template<typename C> struct tape_output<guarded_storage_t<C> > {
+        static void watch(io_t* io)
+        {
+                guarded_output_t& output = guarded_output();
+
+                output.fd   = -1;
+                output.data = io ? io->buffered() : 0;
+                output.size = io ? &io->buffered_size() : 0;
+                output.fd   = io ? io->output_fd() : -1;
+        }
+};
+
+//! A move that jumps the guard would land in whatever is mapped beyond it.
+template<typename C> struct tape_reach<guarded_storage_t<C> > {
+        static const std::size_t value = guarded_guard_bytes / sizeof(C);
+};
+
+} // namespace detail
+
+#endif /* _H_BF_GUARDED */
\ No newline at end of file
@@ -0,0 +1,31 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_INLINE
+#define _H_BF_INLINE
+
+//! For the small functions every interpreter step goes through. With many engines
+//  instantiated in one program the compiler's inlining budget runs out, and a
+//  call per cell access costs more than the access itself.
+#if defined(__GNUC__)
+#  define BF_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#  define BF_ALWAYS_INLINE inline
+#endif
+
+#endif /* _H_BF_INLINE */
\ No newline at end of file
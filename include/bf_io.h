@@ -0,0 +1,403 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_IO
+#define _H_BF_IO
+
+#include <unistd.h>
+#include <errno.h>
+
+#include <stdexcept>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+
+namespace detail {
+
+//! When buffered output is written out, besides when the buffer is full and at exit.
+enum flush_t {
+        FLUSH_Line                   // after every newline and before waiting for input
+      , FLUSH_Block                  // before waiting for input
+      , FLUSH_Never                  // only when full, prompts may show up late
+};
+
+//! What ',' stores once the input is exhausted.
+enum eof_t {
+        EOF_Zero
+      , EOF_MinusOne
+      , EOF_Unchanged
+};
+
+const std::size_t io_buffer_bytes = std::size_t(1) << 16;
+
+//! Where program input comes from. read fills at most size bytes and returns how
+//  many it did, 0 once the input is exhausted.
+struct source_t {
+        virtual ~source_t() {}
+        virtual std::size_t read(char* data, std::size_t size) = 0;
+};
+
+//! Where program output goes. write takes all of it or throws.
+struct sink_t {
+        virtual ~sink_t() {}
+        virtual void write(const char* data, std::size_t size) = 0;
+};
+
+//! A file descriptor. Read errors are taken as the end of the input.
+struct fd_source_t : source_t {
+        explicit fd_source_t(int fd = STDIN_FILENO) : fd(fd) {
+        }
+
+        std::size_t read(char* data, std::size_t size);
+
+        int fd;
+};
+
+struct fd_sink_t : sink_t {
+        explicit fd_sink_t(int fd = STDOUT_FILENO) : fd(fd) {
+        }
+
+        void write(const char* data, std::size_t size);
+
+        int fd;
+};
+
+//! Memory owned by the caller, read from the start.
+struct buffer_source_t : source_t {
+        buffer_source_t(const char* data = 0, std::size_t size = 0) : data(data), size(size), used(0) {
+        }
+
+        std::size_t read(char* into, std::size_t capacity);
+
+        const char* data;
+        std::size_t size;
+        std::size_t used;
+};
+
+//! Memory owned by the caller, filled from the start. Output past capacity is an error.
+struct buffer_sink_t : sink_t {
+        buffer_sink_t(char* data = 0, std::size_t capacity = 0) : data(data), capacity(capacity), size(0) {
+        }
+
+        void write(const char* from, std::size_t count);
+
+        char* data;
+        std::size_t capacity;
+        std::size_t size;                    // bytes written so far
+};
+
+//! Calls f(data, size) - a function, or anything else that can be called that way,
+//  stored by value so that nothing is allocated. As a source, f returns the number
+//  of bytes it filled.
+template<typename F> struct callback_source_t : source_t {
+        explicit callback_source_t(F f) : f(f) {
+        }
+
+        std::size_t read(char* data, std::size_t size) { return f(data, size); }
+
+        F f;
+};
+
+template<typename F> struct callback_sink_t : sink_t {
+        explicit callback_sink_t(F f) : f(f) {
+        }
+
+        void write(const char* data, std::size_t size) { f(data, size); }
+
+        F f;
+};
+
+template<typename F> callback_source_t<F> callback_source(F f)
+{
+        return callback_source_t<F>(f);
+}
+
+template<typename F> callback_sink_t<F> callback_sink(F f)
+{
+        return callback_sink_t<F>(f);
+}
+
+inline std::size_t fd_source_t::read(char* data, std::size_t size)
+{
+        for (;;) {
+                ssize_t result = ::read(fd, data, size);
+
+                if (result < 0 && errno == EINTR)
+                        continue;
+
+                return result < 0 ? 0 : result;
+        }
+}
+
+inline void fd_sink_t::write(const char* data, std::size_t size)
+{
+        std::size_t written = 0;
+
+        while (written != size) {
+                ssize_t result = ::write(fd, data + written, size - written);
+
+                if (result < 0 && errno == EINTR)
+                        continue;
+
+                if (result <= 0)
+                        throw std::runtime_error("can't write output");
+
+                written += result;
+        }
+}
+
+inline std::size_t buffer_source_t::read(char* into, std::size_t capacity)
+{
+        std::size_t count = size - used < capacity ? size - used : capacity;
+
+        std::memcpy(into, data + used, count);
+        used += count;
+
+        return count;
+}
+
+inline void buffer_sink_t::write(const char* from, std::size_t count)
+{
+        if (count > capacity - size)
+                throw std::runtime_error("output buffer full");
+
+        std::memcpy(data + size, from, count);
+        size += count;
+}
+
+//! Buffered program I/O. Output is collected in user space and written out in bulk,
+//  input is read a buffer at a time, so '.' and ',' are almost never a call into
+//  the source or the sink - a system call for file descriptors.
+struct io_t {
+        explicit io_t(int input = STDIN_FILENO, int output = STDOUT_FILENO, flush_t flush = FLUSH_Block, eof_t eof = EOF_MinusOne);
+        io_t(source_t& input, sink_t& output, flush_t flush = FLUSH_Block, eof_t eof = EOF_MinusOne);
+        ~io_t();
+
+        void put(int value);
+        void put(int value, unsigned int count);  // value written count times
+
+        template<typename C> void get(C& cell);
+
+        void flush();
+        void flush_quietly();                     // as flush, for use while reporting another error
+
+        //! Moves on to another pair of descriptors, or of a source and a sink, keeping
+        //  the buffers. Whatever is still buffered for the old output is written out
+        //  first.
+        void attach(int input, int output, flush_t flush);
+        void attach(source_t& input, sink_t& output, flush_t flush);
+
+        //! Line buffered for terminals, block buffered otherwise - what stdio does.
+        static flush_t default_flush(int output = STDOUT_FILENO);
+
+        //! Bytes the program has read and written since the last attach, buffered
+        //  output included. skip reads count bytes of input and drops them, so that
+        //  a program resumed from a checkpoint carries on where it had got to.
+        unsigned long long consumed() const { return in_read_ - (in_size_ - in_used_); }
+        unsigned long long produced() const { return out_written_ + out_used_; }
+        void skip(unsigned long long count);
+
+        //! The descriptor output goes to, -1 unless it is an fd_sink_t, and what is
+        //  buffered for it - for a fault handler, which can't call into the sink.
+        int output_fd() const;
+        const char* buffered() const { return &out_[0]; }
+        const std::size_t& buffered_size() const { return out_used_; }
+
+private:
+        io_t(const io_t&);
+        io_t& operator =(const io_t&);
+
+        bool fill();
+
+        fd_source_t fd_input_;               // used when attached to descriptors
+        fd_sink_t fd_output_;
+
+        source_t* input_;
+        sink_t* output_;
+        flush_t flush_;
+        eof_t eof_;
+
+        std::vector<char> out_;
+        std::size_t out_used_;
+
+        std::vector<char> in_;
+        std::size_t in_used_;
+        std::size_t in_size_;
+        bool in_closed_;
+
+        unsigned long long in_read_;
+        unsigned long long out_written_;
+};
+
+inline io_t::io_t(int input, int output, flush_t flush, eof_t eof)
+        : fd_input_(input), fd_output_(output), input_(&fd_input_), output_(&fd_output_), flush_(flush), eof_(eof)
+        , out_(io_buffer_bytes), out_used_(0)
+        , in_(io_buffer_bytes), in_used_(0), in_size_(0), in_closed_(false)
+        , in_read_(0), out_written_(0)
+{
+}
+
+inline io_t::io_t(source_t& input, sink_t& output, flush_t flush, eof_t eof)
+        : input_(&input), output_(&output), flush_(flush), eof_(eof)
+        , out_(io_buffer_bytes), out_used_(0)
+        , in_(io_buffer_bytes), in_used_(0), in_size_(0), in_closed_(false)
+        , in_read_(0), out_written_(0)
+{
+}
+
+inline io_t::~io_t()
+{
+        flush_quietly();
+}
+
+inline void io_t::put(int value)
+{
+        if (out_used_ == out_.size())
+                flush();
+
+        out_[out_used_++] = static_cast<char>(value);
+
+        if (flush_ == FLUSH_Line && static_cast<char>(value) == '\n')
+                flush();
+}
+
+inline void io_t::put(int value, unsigned int count)
+{
+        if (flush_ == FLUSH_Line && static_cast<char>(value) == '\n') {
+                while (count--)
+                        put(value);
+                return;
+        }
+
+        while (count != 0) {
+                if (out_used_ == out_.size())
+                        flush();
+
+                std::size_t run = out_.size() - out_used_ < count ? out_.size() - out_used_ : count;
+
+                std::memset(&out_[out_used_], value, run);
+                out_used_ += run;
+                count -= static_cast<unsigned int>(run);
+        }
+}
+
+template<typename C> inline void io_t::get(C& cell)
+{
+        if (in_used_ == in_size_ && !fill()) {
+                if (eof_ == EOF_Zero)
+                        cell = 0;
+                else if (eof_ == EOF_MinusOne)
+                        cell = static_cast<C>(-1);
+                return;
+        }
+
+        cell = static_cast<C>(static_cast<unsigned char>(in_[in_used_++]));
+}
+
+inline int io_t::output_fd() const
+{
+        const fd_sink_t* sink = dynamic_cast<const fd_sink_t*>(output_);
+
+        return sink ? sink->fd : -1;
+}
+
+inline void io_t::flush()
+{
+        std::size_t used = out_used_;
+
+        //! Dropped on failure as well, it wouldn't go through the next time either.
+        out_used_ = 0;
+        out_written_ += used;
+
+        if (used != 0)
+                output_->write(&out_[0], used);
+}
+
+inline void io_t::flush_quietly()
+{
+        try {
+                flush();
+        }
+        catch (std::runtime_error&) {
+        }
+}
+
+//! Reads whatever is available, up to a buffer. False once the input is exhausted.
+//  Output is flushed first since the read may block - a prompt has to be out by then,
+//  but input that is already buffered needs no system call on either side.
+inline bool io_t::fill()
+{
+        if (flush_ != FLUSH_Never)
+                flush();
+
+        if (in_closed_)
+                return false;
+
+        //! Counts stay as they were while the read is under way, or if it throws.
+        std::size_t size = input_->read(&in_[0], in_.size());
+
+        in_used_ = 0;
+        in_size_ = size;
+        in_closed_ = in_size_ == 0;
+        in_read_ += in_size_;
+
+        return !in_closed_;
+}
+
+inline void io_t::skip(unsigned long long count)
+{
+        while (count != 0) {
+                if (in_used_ == in_size_ && !fill())
+                        return;
+
+                std::size_t run = in_size_ - in_used_ < count ? in_size_ - in_used_ : static_cast<std::size_t>(count);
+
+                in_used_ += run;
+                count -= run;
+        }
+}
+
+inline void io_t::attach(int input, int output, flush_t flush)
+{
+        flush_quietly();
+
+        fd_input_.fd = input;
+        fd_output_.fd = output;
+        attach(fd_input_, fd_output_, flush);
+}
+
+inline void io_t::attach(source_t& input, sink_t& output, flush_t flush)
+{
+        flush_quietly();
+
+        input_ = &input;
+        output_ = &output;
+        flush_ = flush;
+        in_used_ = in_size_ = 0;
+        in_closed_ = false;
+        in_read_ = out_written_ = 0;
+}
+
+inline flush_t io_t::default_flush(int output)
+{
+        return isatty(output) ? FLUSH_Line : FLUSH_Block;
+}
+
+} // namespace detail
+
+#endif /* _H_BF_IO */
\ No newline at end of file
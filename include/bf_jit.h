@@ -0,0 +1,1061 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_JIT
+#define _H_BF_JIT
+
+#include "bf_evaluate.h"
+#include "bf_threaded.h"
+#include "bf_bytecode.h"
+#include "bf_scan.h"
+#include "bf_guarded.h"
+#include "bf_paged.h"
+#include "bf_profile.h"
+#include "bf_budget.h"
+#include "bf_prefix.h"
+
+#if defined(__x86_64__) && defined(__unix__)
+#  define BF_HAVE_JIT 1
+#endif
+
+#if defined(BF_HAVE_JIT)
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+
+namespace detail {
+
+//! Everything the generated code needs from the outside world. The code only
+//  reaches it through r12, so the machine code itself holds no absolute addresses.
+struct jit_context_t {
+        void* (*grow)(jit_context_t* context, void* cell, unsigned int index);
+        void* (*scan)(jit_context_t* context, void* cell, int stride, unsigned int index);
+        int   (*output)(jit_context_t* context, int value, unsigned int count, unsigned int index);
+        int   (*input)(jit_context_t* context, void* cell, unsigned int index);
+        void* low;                   // lowest cell pointer for which every access is in bounds
+        void* high;                  // one past the highest such pointer
+        void* tape;                  // owner of the cells, used by grow
+        void* io;                    // program I/O, used by output and input
+        unsigned int fault;          // index of the instruction that failed
+        const char* error;           // and why
+        void* cell;                  // where the code stopped, set on the way out
+        int   (*refill)(jit_context_t* context, unsigned int index);
+        void* budget;                // what refill takes the next slice of steps from
+        uint64_t steps;              // steps left in the slice, kept in r15 while running
+};
+
+//! Raw x86-64 machine code under construction.
+struct assembler_t {
+        std::vector<unsigned char> bytes;
+
+        void byte(int value)          { bytes.push_back(static_cast<unsigned char>(value)); }
+        void word(int value)          { byte(value); byte(value >> 8); }
+        void dword(int value)         { word(value); word(value >> 16); }
+        std::size_t here() const      { return bytes.size(); }
+
+        //! Emits a rel32 jump/call field pointing at target (or a placeholder).
+        std::size_t rel32(std::size_t target = 0);
+        void patch(std::size_t field, std::size_t target);
+};
+
+inline std::size_t assembler_t::rel32(std::size_t target)
+{
+        std::size_t field = here();
+
+        dword(0);
+        patch(field, target);
+
+        return field;
+}
+
+inline void assembler_t::patch(std::size_t field, std::size_t target)
+{
+        int relative = static_cast<int>(target) - static_cast<int>(field + 4);
+
+        std::memcpy(&bytes[field], &relative, sizeof relative);
+}
+
+//! Machine code copied into its own mapping, writable while copying and executable
+//  afterwards - never both.
+struct executable_t {
+        explicit executable_t(const assembler_t& code);
+        ~executable_t();
+
+        const void* entry() const { return memory_; }
+
+private:
+        executable_t(const executable_t&);
+        executable_t& operator =(const executable_t&);
+
+        void* memory_;
+        std::size_t size_;
+};
+
+inline executable_t::executable_t(const assembler_t& code) : memory_(0), size_(code.bytes.size())
+{
+        memory_ = mmap(0, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (memory_ == MAP_FAILED)
+                throw std::runtime_error("can't allocate memory for native code");
+
+        std::memcpy(memory_, &code.bytes[0], size_);
+
+        if (mprotect(memory_, size_, PROT_READ | PROT_EXEC) != 0) {
+                munmap(memory_, size_);
+                throw std::runtime_error("can't make native code executable");
+        }
+}
+
+inline executable_t::~executable_t()
+{
+        munmap(memory_, size_);
+}
+
+//! Condition codes for x86_64_emitter_t::jump.
+enum {
+        JCC_Below        = 0x82
+      , JCC_AboveOrEqual = 0x83
+      , JCC_Equal        = 0x84
+      , JCC_NotEqual     = 0x85
+};
+
+//! Register use: rbx - cell pointer, r12 - context, r13/r14 - bounds of rbx, r15 -
+//  steps left in the budget's slice.
+template<typename C> struct x86_64_emitter_t {
+        explicit x86_64_emitter_t(assembler_t& a) : a_(a) {
+        }
+
+        void prologue();
+        void epilogue();
+
+        void add(int offset, int value);
+        void set(int offset, int value);
+        void compare_zero(int offset);
+        void load(int offset);                 // eax = cell
+        void store(int offset);                // cell = eax
+        void accumulate(int offset);           // cell += eax
+        void multiply(int factor);             // eax *= factor
+        void move(int value);                  // rbx += value * sizeof(C)
+        void call(int context_offset);
+        void pass_value();                     // esi = eax
+        void pass_context();                   // rdi = r12
+
+        std::size_t jump(int condition);       // jcc rel32 (0x80 | cc), 0 for jmp
+        std::size_t exit(int status);          // eax = status, jump to the epilogue
+
+        void check_bounds(unsigned int index); // r13 <= rbx < r14 or take a slow path
+        void check_reach(int offset, unsigned int index);  // r13 <= rbx + offset or fail
+        void spend(std::size_t target, unsigned int index); // take a step and jump to target, or refill
+        void scan(int stride, unsigned int index);
+        void output(int offset, unsigned int count, unsigned int index);
+        void input(int offset, unsigned int index);
+        void slow_paths();                     // grow the tape or fail, ends in the epilogue
+
+        std::size_t epilogue_at;
+
+private:
+        struct slow_path_t {
+                std::size_t  below;
+                std::size_t  above;
+                std::size_t  resume;
+                unsigned int index;
+        };
+
+        void operand_size();
+        void memory(int reg, int offset);
+        void load_bounds();
+
+        assembler_t& a_;
+        std::vector<slow_path_t> slow_paths_;
+        std::vector<slow_path_t> underflows_;
+        std::vector<slow_path_t> refills_;
+        std::vector<std::size_t> failures_;
+};
+
+template<typename C> inline void x86_64_emitter_t<C>::operand_size()
+{
+        if (sizeof(C) == 2)
+                a_.byte(0x66);
+        else if (sizeof(C) == 8)
+                a_.byte(0x48);
+}
+
+//! ModRM for [rbx + offset * sizeof(C)].
+template<typename C> inline void x86_64_emitter_t<C>::memory(int reg, int offset)
+{
+        int displacement = offset * static_cast<int>(sizeof(C));
+
+        if (displacement == 0) {
+                a_.byte(0x03 | reg << 3);
+        }
+        else if (displacement >= -128 && displacement <= 127) {
+                a_.byte(0x43 | reg << 3);
+                a_.byte(displacement);
+        }
+        else {
+                a_.byte(0x83 | reg << 3);
+                a_.dword(displacement);
+        }
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::prologue()
+{
+        a_.byte(0x53);                                         // push rbx
+        a_.byte(0x41); a_.byte(0x54);                          // push r12
+        a_.byte(0x41); a_.byte(0x55);                          // push r13
+        a_.byte(0x41); a_.byte(0x56);                          // push r14
+        a_.byte(0x41); a_.byte(0x57);                          // push r15
+        a_.byte(0x48); a_.byte(0x89); a_.byte(0xfb);           // mov rbx, rdi
+        a_.byte(0x49); a_.byte(0x89); a_.byte(0xf4);           // mov r12, rsi
+        a_.byte(0x4d); a_.byte(0x8b); a_.byte(0x7c); a_.byte(0x24); a_.byte(offsetof(jit_context_t, steps));  // mov r15, [r12 + steps]
+
+        load_bounds();
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::load_bounds()
+{
+        a_.byte(0x4d); a_.byte(0x8b); a_.byte(0x6c); a_.byte(0x24); a_.byte(offsetof(jit_context_t, low));   // mov r13, [r12 + low]
+        a_.byte(0x4d); a_.byte(0x8b); a_.byte(0x74); a_.byte(0x24); a_.byte(offsetof(jit_context_t, high));  // mov r14, [r12 + high]
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::epilogue()
+{
+        epilogue_at = a_.here();
+
+        a_.byte(0x49); a_.byte(0x89); a_.byte(0x5c); a_.byte(0x24); a_.byte(offsetof(jit_context_t, cell));  // mov [r12 + cell], rbx
+        a_.byte(0x4d); a_.byte(0x89); a_.byte(0x7c); a_.byte(0x24); a_.byte(offsetof(jit_context_t, steps)); // mov [r12 + steps], r15
+        a_.byte(0x41); a_.byte(0x5f);                          // pop r15
+        a_.byte(0x41); a_.byte(0x5e);                          // pop r14
+        a_.byte(0x41); a_.byte(0x5d);                          // pop r13
+        a_.byte(0x41); a_.byte(0x5c);                          // pop r12
+        a_.byte(0x5b);                                         // pop rbx
+        a_.byte(0xc3);                                         // ret
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::add(int offset, int value)
+{
+        if (sizeof(C) == 1) {
+                a_.byte(0x80); memory(0, offset); a_.byte(value);
+                return;
+        }
+
+        operand_size();
+
+        if (value >= -128 && value <= 127) {
+                a_.byte(0x83); memory(0, offset); a_.byte(value);
+        }
+        else {
+                a_.byte(0x81); memory(0, offset);
+                if (sizeof(C) == 2)
+                        a_.word(value);
+                else
+                        a_.dword(value);
+        }
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::set(int offset, int value)
+{
+        operand_size();
+
+        a_.byte(sizeof(C) == 1 ? 0xc6 : 0xc7);
+        memory(0, offset);
+
+        if (sizeof(C) == 1)
+                a_.byte(value);
+        else if (sizeof(C) == 2)
+                a_.word(value);
+        else
+                a_.dword(value);
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::compare_zero(int offset)
+{
+        operand_size();
+
+        a_.byte(sizeof(C) == 1 ? 0x80 : 0x83);
+        memory(7, offset);
+        a_.byte(0);
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::load(int offset)
+{
+        if (sizeof(C) == 1) {
+                a_.byte(0x0f); a_.byte(0xb6);
+        }
+        else if (sizeof(C) == 2) {
+                a_.byte(0x0f); a_.byte(0xb7);
+        }
+        else {
+                operand_size();
+                a_.byte(0x8b);
+        }
+
+        memory(0, offset);
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::store(int offset)
+{
+        operand_size();
+
+        a_.byte(sizeof(C) == 1 ? 0x88 : 0x89);
+        memory(0, offset);
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::accumulate(int offset)
+{
+        operand_size();
+
+        a_.byte(sizeof(C) == 1 ? 0x00 : 0x01);
+        memory(0, offset);
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::multiply(int factor)
+{
+        if (factor == 1)
+                return;
+
+        if (sizeof(C) == 8)
+                a_.byte(0x48);
+
+        if (factor == -1) {
+                a_.byte(0xf7); a_.byte(0xd8);                  // neg eax
+                return;
+        }
+
+        a_.byte(0x69); a_.byte(0xc0); a_.dword(factor);        // imul eax, eax, factor
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::move(int value)
+{
+        int displacement = value * static_cast<int>(sizeof(C));
+
+        a_.byte(0x48);
+
+        if (displacement >= -128 && displacement <= 127) {
+                a_.byte(0x83); a_.byte(0xc3); a_.byte(displacement);
+        }
+        else {
+                a_.byte(0x81); a_.byte(0xc3); a_.dword(displacement);
+        }
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::call(int context_offset)
+{
+        a_.byte(0x41); a_.byte(0xff); a_.byte(0x54); a_.byte(0x24); a_.byte(context_offset);   // call [r12 + offset]
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::pass_value()
+{
+        a_.byte(0x89); a_.byte(0xc6);                          // mov esi, eax
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::pass_context()
+{
+        a_.byte(0x4c); a_.byte(0x89); a_.byte(0xe7);           // mov rdi, r12
+}
+
+template<typename C> inline std::size_t x86_64_emitter_t<C>::jump(int condition)
+{
+        if (condition == 0) {
+                a_.byte(0xe9);
+        }
+        else {
+                a_.byte(0x0f); a_.byte(condition);
+        }
+
+        return a_.rel32();
+}
+
+template<typename C> inline std::size_t x86_64_emitter_t<C>::exit(int status)
+{
+        a_.byte(0xb8); a_.dword(status);                       // mov eax, status
+
+        return jump(0);
+}
+
+template<typename C> inline void x86_64_emitter_t<C>::check_bounds(unsigned int index)
+{
+        slow_path_t slow;
+
+        a_.byte(0x4c); a_.byte(0x39); a_.byte(0xeb);           // cmp rbx, r13
+        slow.below = jump(JCC_Below);
+        a_.byte(0x4c); a_.byte(0x39); a_.byte(0xf3);           // cmp rbx, r14
+        slow.above = jump(JCC_AboveOrEqual);
+        slow.resume = a_.here();
+        slow.index = index;
+
+        slow_paths_.push_back(slow);
+}
+
+//! Moves are put off within a block, so a cell left of the pc may be accessed before
+//  the pc gets there. The padding left of the origin keeps that from faulting, this
+//  keeps it from going unnoticed.
+template<typename C> inline void x86_64_emitter_t<C>::check_reach(int offset, unsigned int index)
+{
+        slow_path_t slow;
+
+        a_.byte(0x48); a_.byte(0x8d); a_.byte(0x83);           // lea rax, [rbx + offset * sizeof(C)]
+        a_.dword(offset * static_cast<int>(sizeof(C)));
+        a_.byte(0x4c); a_.byte(0x39); a_.byte(0xe8);           // cmp rax, r13
+        slow.below = jump(JCC_Below);
+        slow.index = index;
+
+        underflows_.push_back(slow);
+}
+
+//! A back-edge of a budgeted loop - counts r15 down, the slow path asks the context
+//  for another slice once it is used up.
+template<typename C> inline void x86_64_emitter_t<C>::spend(std::size_t target, unsigned int index)
+{
+        slow_path_t slow;
+
+        a_.byte(0x49); a_.byte(0x83); a_.byte(0xef); a_.byte(1);   // sub r15, 1
+        slow.below = jump(JCC_Below);
+        slow.resume = target;
+        slow.index = index;
+        a_.patch(jump(0), target);
+
+        refills_.push_back(slow);
+}
+
+//! Calls out to the vector scan unless the current cell is already zero.
+template<typename C> inline void x86_64_emitter_t<C>::scan(int stride, unsigned int index)
+{
+        compare_zero(0);
+        std::size_t done = jump(JCC_Equal);
+
+        pass_context();
+        a_.byte(0x48); a_.byte(0x89); a_.byte(0xde);           // mov rsi, rbx
+        a_.byte(0xba); a_.dword(stride);                       // mov edx, stride
+        a_.byte(0xb9); a_.dword(index);                        // mov ecx, index
+        call(offsetof(jit_context_t, scan));
+        a_.byte(0x48); a_.byte(0x85); a_.byte(0xc0);           // test rax, rax
+        failures_.push_back(jump(JCC_Equal));
+        a_.byte(0x48); a_.byte(0x89); a_.byte(0xc3);           // mov rbx, rax
+        load_bounds();
+
+        a_.patch(done, a_.here());
+}
+
+//! Writes the cell count times, fails if the context can't.
+template<typename C> inline void x86_64_emitter_t<C>::output(int offset, unsigned int count, unsigned int index)
+{
+        load(offset);
+        pass_value();
+        pass_context();
+        a_.byte(0xba); a_.dword(count);                        // mov edx, count
+        a_.byte(0xb9); a_.dword(index);                        // mov ecx, index
+        call(offsetof(jit_context_t, output));
+        a_.byte(0x85); a_.byte(0xc0);                          // test eax, eax
+        failures_.push_back(jump(JCC_NotEqual));
+}
+
+//! Lets the context read straight into the cell, fails if it can't.
+template<typename C> inline void x86_64_emitter_t<C>::input(int offset, unsigned int index)
+{
+        pass_context();
+        a_.byte(0x48); a_.byte(0x8d); a_.byte(0xb3);           // lea rsi, [rbx + offset * sizeof(C)]
+        a_.dword(offset * static_cast<int>(sizeof(C)));
+        a_.byte(0xba); a_.dword(index);                        // mov edx, index
+        call(offsetof(jit_context_t, input));
+        a_.byte(0x85); a_.byte(0xc0);                          // test eax, eax
+        failures_.push_back(jump(JCC_NotEqual));
+}
+
+//! Slow paths - grow the tape, reload the bounds and carry on, or return 1.
+template<typename C> inline void x86_64_emitter_t<C>::slow_paths()
+{
+        for (std::size_t i = 0; i != slow_paths_.size(); ++i) {
+                a_.patch(slow_paths_[i].below, a_.here());
+                a_.patch(slow_paths_[i].above, a_.here());
+
+                pass_context();
+                a_.byte(0x48); a_.byte(0x89); a_.byte(0xde);           // mov rsi, rbx
+                a_.byte(0xba); a_.dword(slow_paths_[i].index);         // mov edx, index
+                call(offsetof(jit_context_t, grow));
+                a_.byte(0x48); a_.byte(0x85); a_.byte(0xc0);           // test rax, rax
+                failures_.push_back(jump(JCC_Equal));
+                a_.byte(0x48); a_.byte(0x89); a_.byte(0xc3);           // mov rbx, rax
+                load_bounds();
+                a_.patch(jump(0), slow_paths_[i].resume);
+        }
+
+        //! Growing the tape from below the origin fails, the context records where.
+        for (std::size_t i = 0; i != underflows_.size(); ++i) {
+                a_.patch(underflows_[i].below, a_.here());
+
+                pass_context();
+                a_.byte(0x48); a_.byte(0x89); a_.byte(0xc6);           // mov rsi, rax
+                a_.byte(0xba); a_.dword(underflows_[i].index);         // mov edx, index
+                call(offsetof(jit_context_t, grow));
+                failures_.push_back(jump(0));
+        }
+
+        for (std::size_t i = 0; i != refills_.size(); ++i) {
+                a_.patch(refills_[i].below, a_.here());
+
+                pass_context();
+                a_.byte(0xbe); a_.dword(refills_[i].index);            // mov esi, index
+                call(offsetof(jit_context_t, refill));
+                a_.byte(0x85); a_.byte(0xc0);                          // test eax, eax
+                failures_.push_back(jump(JCC_Equal));
+                a_.byte(0x4d); a_.byte(0x8b); a_.byte(0x7c); a_.byte(0x24); a_.byte(offsetof(jit_context_t, steps));  // mov r15, [r12 + steps]
+                a_.patch(jump(0), refills_[i].resume);
+        }
+
+        for (std::size_t i = 0; i != failures_.size(); ++i)
+                a_.patch(failures_[i], a_.here());
+
+        a_.byte(0xb8); a_.dword(1);                            // mov eax, 1, falls into the epilogue
+}
+
+//! Translates bytecode into a function C* -> status. When checked, every pointer move
+//  is followed by a bounds check whose slow path asks the context to grow the tape,
+//  and every offset further left than the block has reached so far by one that
+//  fails below the origin. Only the instructions from first up to last are
+//  translated - a whole loop, or the whole program - the code returns once it
+//  gets past them. When budgeted, every back-edge takes a step from the context.
+template<typename C>
+void jit_compile(const bytecode_t& bytecode, assembler_t& a, bool checked = true, std::size_t first = 0, std::size_t last = std::size_t(-1),
+                 bool budgeted = false)
+{
+        x86_64_emitter_t<C> emit(a);
+
+        std::vector<std::size_t> loop_ends(bytecode.code.size());
+        std::vector<std::size_t> halts;
+
+        if (last > bytecode.code.size())
+                last = bytecode.code.size();
+
+        emit.prologue();
+
+        //! The entry point is checked as if a move happened right before it.
+        if (checked)
+                emit.check_bounds(static_cast<unsigned int>(first));
+
+        int reached = 0;
+
+        for (std::size_t i = first; i != last; ++i) {
+                const instruction_t& instruction = bytecode.code[i];
+                unsigned int index = static_cast<unsigned int>(i);
+                std::size_t skip = 0;
+
+                //! A multiply-add only touches its cell when the current one isn't zero,
+                //  so its reach is checked past that test and counts for nothing after.
+                if (!addresses_cell(instruction.opcode)) {
+                        reached = 0;
+                }
+                else if (checked && instruction.offset < reached) {
+                        if (instruction.opcode == OP_MulAdd) {
+                                emit.compare_zero(0);
+                                skip = emit.jump(JCC_Equal);
+                        }
+                        else {
+                                reached = instruction.offset;
+                        }
+
+                        emit.check_reach(instruction.offset, index);
+                }
+
+                switch (instruction.opcode) {
+                case OP_Add:
+                        emit.add(instruction.offset, instruction.operand);
+                        break;
+                case OP_Move:
+                        emit.move(instruction.operand);
+                        if (checked)
+                                emit.check_bounds(index);
+                        break;
+                case OP_Output:
+                        emit.output(instruction.offset, instruction.operand, index);
+                        break;
+                case OP_Input:
+                        emit.input(instruction.offset, index);
+                        break;
+                case OP_Open:
+                        emit.compare_zero(0);
+                        loop_ends[i] = emit.jump(JCC_Equal);
+                        loop_ends[instruction.operand] = a.here();
+                        break;
+                case OP_Close:
+                        emit.compare_zero(0);
+                        if (budgeted) {
+                                std::size_t done = emit.jump(JCC_Equal);
+
+                                emit.spend(loop_ends[i], index);
+                                a.patch(done, a.here());
+                        }
+                        else {
+                                a.patch(emit.jump(JCC_NotEqual), loop_ends[i]);
+                        }
+                        a.patch(loop_ends[instruction.operand], a.here());
+                        break;
+                case OP_Clear:
+                        emit.set(instruction.offset, 0);
+                        break;
+                case OP_MulAdd:
+                        emit.load(0);
+                        emit.multiply(instruction.operand);
+                        emit.accumulate(instruction.offset);
+                        break;
+                case OP_Scan:
+                        emit.scan(instruction.operand, index);
+                        break;
+                case OP_Set:
+                        emit.set(instruction.offset, instruction.operand);
+                        break;
+                case OP_Halt:
+                        halts.push_back(emit.exit(0));
+                        break;
+                }
+
+                if (skip)
+                        a.patch(skip, a.here());
+        }
+
+        if (last == 0 || bytecode.code[last - 1].opcode != OP_Halt)
+                halts.push_back(emit.exit(0));
+
+        emit.slow_paths();
+        emit.epilogue();
+
+        for (std::size_t i = 0; i != halts.size(); ++i)
+                a.patch(halts[i], emit.epilogue_at);
+}
+
+//! Tape used by the generated code on top of a vector, grows the same way cells_t
+//  does. Cells left of the origin are padding for negative offsets, only the
+//  pointer itself is checked.
+template<typename C> struct jit_vector_tape_t {
+        static const bool checked = true;
+
+        jit_vector_tape_t(int lowest, int highest) : cells_(65536 - lowest), origin_(-lowest), highest_(highest) {
+        }
+
+        void bind(jit_context_t& context);
+
+        C* base()                { return &cells_[origin_]; }
+        std::ptrdiff_t size()    { return cells_.size() - origin_; }
+        std::ptrdiff_t extent();             // see written_extent
+        C* start()               { return base(); }
+        C* reserve(jit_context_t& context, std::ptrdiff_t position);
+
+private:
+        std::vector<C> cells_;
+        std::ptrdiff_t origin_;
+        int highest_;
+};
+
+template<typename C> inline void jit_vector_tape_t<C>::bind(jit_context_t& context)
+{
+        context.tape = this;
+        context.low  = base();
+        context.high = &cells_[0] + cells_.size() - highest_;
+}
+
+template<typename C> inline std::ptrdiff_t jit_vector_tape_t<C>::extent()
+{
+        std::ptrdiff_t extent = size();
+
+        while (extent != 0 && base()[extent - 1] == 0)
+                --extent;
+
+        return extent;
+}
+
+//! Makes sure every access from position is in bounds, returns the cell there.
+template<typename C> inline C* jit_vector_tape_t<C>::reserve(jit_context_t& context, std::ptrdiff_t position)
+{
+        if (origin_ + position + highest_ >= static_cast<std::ptrdiff_t>(cells_.size()))
+                cells_.resize(origin_ + position + highest_ + growth_factor(), 0);
+
+        bind(context);
+
+        return base() + position;
+}
+
+//! Tape used by the generated code on top of guarded storage - the guard pages do
+//  the bounds checking, so none is generated.
+template<typename C> struct jit_guarded_tape_t {
+        static const bool checked = false;
+
+        jit_guarded_tape_t(int, int) {
+        }
+
+        void bind(jit_context_t& context);
+
+        C* base()                { return cells_.data(); }
+        std::ptrdiff_t size()    { return cells_.size(); }
+        std::ptrdiff_t extent()  { return size(); }
+        C* start()               { return base() + guarded_storage_t<C>::origin(); }
+        C* reserve(jit_context_t&, std::ptrdiff_t position) { return base() + position; }
+
+private:
+        cells_t<guarded_storage_t<C> > cells_;
+};
+
+template<typename C> inline void jit_guarded_tape_t<C>::bind(jit_context_t& context)
+{
+        context.tape = this;
+        context.low  = base();
+        context.high = base() + size();
+}
+
+//! The generated code's tape for each cell storage.
+template<typename S> struct jit_tape_of;
+
+template<typename C> struct jit_tape_of<std::vector<C> > {
+        typedef jit_vector_tape_t<C> type;
+};
+
+template<typename C> struct jit_tape_of<guarded_storage_t<C> > {
+        typedef jit_guarded_tape_t<C> type;
+};
+
+//! Generated code addresses cells directly, a paged tape is laid out as a vector
+//  for it.
+template<typename C> struct jit_tape_of<paged_storage_t<C> > {
+        typedef jit_vector_tape_t<C> type;
+};
+
+template<typename C, typename Tape> void* jit_grow(jit_context_t* context, void* cell, unsigned int index)
+{
+        Tape& tape = *static_cast<Tape*>(context->tape);
+        std::ptrdiff_t position = static_cast<C*>(cell) - tape.base();
+
+        context->fault = index;
+        context->error = "pc underflow";
+
+        if (position < 0)
+                return 0;
+
+        return tape.reserve(*context, position);
+}
+
+template<typename C, typename Tape> void* jit_scan(jit_context_t* context, void* cell, int stride, unsigned int index)
+{
+        Tape& tape = *static_cast<Tape*>(context->tape);
+        std::ptrdiff_t position = static_cast<C*>(cell) - tape.base();
+
+        context->fault = index;
+        context->error = "pc underflow";
+
+        if (stride > 0)
+                position = scan_forward(tape.base(), tape.size(), position, stride);
+        else if ((position = scan_backward(tape.base(), tape.size(), position, -stride)) < 0)
+                return 0;
+
+        return tape.reserve(*context, position);
+}
+
+//! I/O errors can't unwind through the generated code, they are handed back as a
+//  nonzero status and reported once it has returned. Writing out the buffer is the
+//  only thing that fails, input just sees the end of it.
+inline int jit_output(jit_context_t* context, int value, unsigned int count, unsigned int index)
+{
+        try {
+                static_cast<io_t*>(context->io)->put(value, count);
+        }
+        catch (std::runtime_error&) {
+                context->fault = index;
+                context->error = "can't write output";
+                return 1;
+        }
+
+        return 0;
+}
+
+template<typename C> int jit_input(jit_context_t* context, void* cell, unsigned int index)
+{
+        try {
+                static_cast<io_t*>(context->io)->get(*static_cast<C*>(cell));
+        }
+        catch (std::runtime_error&) {
+                context->fault = index;
+                context->error = "can't write output";
+                return 1;
+        }
+
+        return 0;
+}
+
+//! The next slice of steps for budgeted code, or the limit it reached at index.
+inline int jit_refill(jit_context_t* context, unsigned int index)
+{
+        budget_t& budget = *static_cast<budget_t*>(context->budget);
+
+        if (!budget.refill()) {
+                context->fault = index;
+                context->error = budget.reached();
+                return 0;
+        }
+
+        context->steps = budget.left();
+        return 1;
+}
+
+//! Hands the budget's slice to native code and takes back what is left of it.
+//  Code compiled without a budget never touches either.
+inline void jit_bind_budget(jit_context_t& context, no_budget_t&)
+{
+        context.refill = 0;
+        context.budget = 0;
+        context.steps  = 0;
+}
+
+inline void jit_bind_budget(jit_context_t& context, budget_t& budget)
+{
+        context.refill = &jit_refill;
+        context.budget = &budget;
+        context.steps  = budget.left();
+}
+
+inline void jit_unbind_budget(jit_context_t&, no_budget_t&)
+{
+}
+
+inline void jit_unbind_budget(jit_context_t& context, budget_t& budget)
+{
+        if (!budget.reached())
+                budget.left(context.steps);
+}
+
+//! Copies the image of a folded prefix onto the tape and returns the cell the
+//  generated code starts at.
+template<typename C, typename Tape> C* jit_restore(Tape& tape, jit_context_t& context, const prefix_t<C>& prefix)
+{
+        std::ptrdiff_t origin = tape.start() - tape.base();
+
+        if (!prefix.image.empty())
+                std::copy(prefix.image.begin(), prefix.image.end(), tape.reserve(context, origin + prefix.image.size()) - prefix.image.size());
+
+        return tape.reserve(context, origin + prefix.pointer);
+}
+
+} // namespace detail
+
+namespace detail {
+
+//! Compiles bytecode, its prefix already folded, to native code and runs it from
+//  where prefix left off, spending every back-edge from the budget. Errors are
+//  reported against the source it came from.
+template<typename C, typename S, typename R, typename B>
+int run_jit(const char* program, size_t program_size, const bytecode_t& bytecode, const prefix_t<C>& prefix, io_t& io, R& recorder,
+            B& budget)
+{
+        typedef int (*entry_t)(C* cell, jit_context_t* context);
+        typedef typename jit_tape_of<S>::type tape_t;
+
+        try {
+                check_reach(bytecode, tape_reach<S>::value);
+        }
+        catch (syntax_error& e) {
+                return display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        int lowest, highest;
+        offset_range(bytecode, lowest, highest);
+
+        assembler_t code;
+        jit_compile<C>(bytecode, code, tape_t::checked, 0, std::size_t(-1), B::enabled);
+
+        executable_t executable(code);
+        tape_t tape(lowest, highest);
+        jit_context_t context;
+
+        context.grow   = &jit_grow<C, tape_t>;
+        context.scan   = &jit_scan<C, tape_t>;
+        context.output = &jit_output;
+        context.input  = &jit_input<C>;
+        context.io     = &io;
+        context.fault  = 0;
+        context.error  = 0;
+        context.cell   = 0;
+        tape.bind(context);
+
+        watched_output_t<S> watched(io);
+        entry_t entry = reinterpret_cast<entry_t>(const_cast<void*>(executable.entry()));
+        C* start = jit_restore(tape, context, prefix);
+
+        try {
+                for (std::size_t i = 0; i != prefix.output.size(); ++i)
+                        io.put(prefix.output[i]);
+        }
+        catch (std::runtime_error& e) {
+                return display_error_cause(e.what(), program, program_size, bytecode.positions[0]);
+        }
+
+        recorder.compiled();
+        budget.start();
+
+        int status = 1;
+
+        context.cell = start;
+
+        if (budget.spend(prefix.steps)) {
+                jit_bind_budget(context, budget);
+                status = entry(start, &context);
+                jit_unbind_budget(context, budget);
+        }
+
+        recorder.finished(tape.size());
+
+        if (status != 0 && B::enabled && budget.reached()) {
+                C* base = tape.base();
+
+                io.flush_quietly();
+                return display_limit_reached<C>(budget, program, program_size, bytecode.positions[context.fault],
+                                                [=](std::size_t index) { return base[index]; },
+                                                tape.extent(), static_cast<C*>(context.cell) - base);
+        }
+
+        if (status != 0) {
+                io.flush_quietly();
+                return display_error_cause(context.error, program, program_size, bytecode.positions[context.fault]);
+        }
+
+        try {
+                io.flush();
+        }
+        catch (std::runtime_error& e) {
+                return display_error_cause(e.what(), program, program_size, static_cast<unsigned int>(program_size));
+        }
+
+        return EXIT_SUCCESS;
+}
+
+template<typename C, typename S, typename R>
+int run_jit(const char* program, size_t program_size, const bytecode_t& bytecode, const prefix_t<C>& prefix, io_t& io, R& recorder)
+{
+        no_budget_t budget;
+
+        return run_jit<C, S>(program, program_size, bytecode, prefix, io, recorder, budget);
+}
+
+} // namespace detail
+
+//! Compiles the program to native code and runs it. Cells wrap around instead of
+//  trapping at their limits. The generated code reports nothing to the recorder,
+//  only when it starts and stops. Without one, or a budget, the start of the
+//  program that doesn't depend on input is run ahead of time and never compiled.
+template<typename C, typename S, typename R, typename B>
+int evaluate_jit(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, B& budget)
+{
+        detail::bytecode_t bytecode;
+
+        try {
+                detail::compile(program, program_size, ignore_unknowns, bytecode);
+        }
+        catch (detail::syntax_error& e) {
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        detail::prefix_t<C> prefix;
+
+        if (!R::enabled && !B::enabled)
+                detail::fold_prefix<C, detail::wrap_policy_t>(bytecode, prefix);
+
+        return detail::run_jit<C, S>(program, program_size, bytecode, prefix, io, recorder, budget);
+}
+
+#else
+
+namespace detail {
+
+//! No native code generation on this platform, the bytecode runs threaded instead.
+template<typename C, typename S, typename R, typename B>
+int run_jit(const char* program, size_t program_size, const bytecode_t& bytecode, const prefix_t<C>& prefix, io_t& io, R& recorder,
+            B& budget)
+{
+        state_t<unsigned int, S, wrap_policy_t> state;
+        std::vector<threaded_t> code;
+        std::size_t at = 0;
+        no_tier_t tier;
+
+        recorder.compiled();
+
+        try {
+                check_reach(bytecode, tape_reach<S>::value);
+                run_threaded<C>(bytecode, prefix, state, io, recorder, tier, budget, code, at);
+        }
+        catch (syntax_error& e) {
+                return display_error_cause(e.what(), program, program_size, e.commands);
+        }
+        catch (budget_exceeded_t&) {
+                return display_limit_reached(budget, program, program_size, bytecode.positions[at], state);
+        }
+        catch (std::runtime_error& e) {
+                return display_error_cause(e.what(), program, program_size, bytecode.positions[at]);
+        }
+
+        return EXIT_SUCCESS;
+}
+
+template<typename C, typename S, typename R>
+int run_jit(const char* program, size_t program_size, const bytecode_t& bytecode, const prefix_t<C>& prefix, io_t& io, R& recorder)
+{
+        no_budget_t budget;
+
+        return run_jit<C, S>(program, program_size, bytecode, prefix, io, recorder, budget);
+}
+
+} // namespace detail
+
+//! No native code generation on this platform, fall back to the threaded interpreter.
+template<typename C, typename S, typename R, typename B>
+int evaluate_jit(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, B& budget)
+{
+        detail::no_tier_t tier;
+
+        return evaluate_threaded<C, S, detail::wrap_policy_t>(program, program_size, ignore_unknowns, io, recorder, tier, budget);
+}
+
+#endif
+
+template<typename C, typename S, typename R>
+int evaluate_jit(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder)
+{
+        detail::no_budget_t budget;
+
+        return evaluate_jit<C, S>(program, program_size, ignore_unknowns, io, recorder, budget);
+}
+
+template<typename C, typename S>
+int evaluate_jit(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io)
+{
+        detail::no_recorder_t recorder;
+
+        return evaluate_jit<C, S>(program, program_size, ignore_unknowns, io, recorder);
+}
+
+template<typename C>
+int evaluate_jit(const char* program, size_t program_size, bool ignore_unknowns = false)
+{
+        detail::io_t io;
+
+        return evaluate_jit<C, std::vector<C> >(program, program_size, ignore_unknowns, io);
+}
+
+#endif /* _H_BF_JIT */
\ No newline at end of file
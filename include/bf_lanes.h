@@ -0,0 +1,581 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_LANES
+#define _H_BF_LANES
+
+#include "bf_bytecode.h"
+#include "bf_prefix.h"
+#include "bf_policy.h"
+#include "bf_cells.h"
+#include "bf_io.h"
+#include "bf_inline.h"
+
+#include <unistd.h>
+
+#include <type_traits>
+#include <stdexcept>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+namespace detail {
+
+const std::size_t lane_vector_bytes = 16;
+
+//! One tape position across every lane, held in a vector register - 16 lanes of
+//  8 bit cells down to 2 of 64 bit ones. Arithmetic is done on the unsigned
+//  counterpart, it wraps and leaves a signed cell with the same bits.
+template<typename C> struct lane_vector {
+        typedef typename std::make_unsigned<C>::type cell_t;
+        typedef cell_t type __attribute__((vector_size(lane_vector_bytes)));
+
+        static const std::size_t lanes = lane_vector_bytes / sizeof(C);
+};
+
+template<typename V> inline bool any_lane(V mask)
+{
+        std::uint64_t halves[2];
+
+        std::memcpy(halves, &mask, sizeof halves);
+        return (halves[0] | halves[1]) != 0;
+}
+
+//! All ones in the lanes whose cell isn't zero.
+template<typename V> inline V nonzero_lanes(V cells)
+{
+        return ~(V)(cells == 0);
+}
+
+//! Runs one program over as many inputs as there are lanes, in lockstep. The tape
+//  interleaves the lanes - a position holds a cell of each - so an instruction on a
+//  cell is one vector operation for all of them. A lane whose cell is zero drops out
+//  of a loop and waits for the others at its end. Each lane keeps its own pc; while
+//  the running lanes share theirs, cells are addressed once for all of them, lane by
+//  lane otherwise. Every lane has its own io and fails on its own, the wrap policy
+//  is the only one there is.
+template<typename C> struct lanes_t {
+        typedef typename lane_vector<C>::cell_t cell_t;
+        typedef typename lane_vector<C>::type   vector_t;
+
+        static const std::size_t count = lane_vector<C>::lanes;
+
+        explicit lanes_t(eof_t eof);
+
+        io_t& io(std::size_t lane) { return *io_[lane]; }
+
+        //! Runs the first used lanes to completion from where prefix left off, with
+        //  the tape zeroed first.
+        void run(const bytecode_t& bytecode, const prefix_t<C>& prefix, std::size_t used);
+
+        //! Why a lane failed, empty if it didn't, and the index of the instruction.
+        const std::string& error(std::size_t lane) const { return errors_[lane]; }
+        std::size_t at(std::size_t lane) const { return at_[lane]; }
+
+private:
+        lanes_t(const lanes_t&);
+        lanes_t& operator =(const lanes_t&);
+
+        //! A loop only some of the lanes are in, and the lanes that were running when
+        //  it was entered - the ones that carry on past it. Loops all of them are in
+        //  have none.
+        struct frame_t {
+                vector_t active;
+                std::size_t open;
+        };
+
+        static vector_t splat(cell_t value) { return vector_t() + value; }
+
+        cell_t& cell(std::size_t lane, unsigned int index) { return reinterpret_cast<cell_t*>(&tape_[index])[lane]; }
+
+        bool running(std::size_t lane) const { return active_[lane] != 0; }
+
+        static const char* shift(unsigned int& pc, int by);
+        bool position(std::size_t lane, int offset, std::size_t ip, unsigned int& index);
+        bool position(int offset, std::size_t ip, unsigned int& index);
+
+        vector_t current();
+        void diverge(vector_t lanes, std::size_t open);
+        void regroup(vector_t lanes);
+        bool unwind(const bytecode_t& bytecode, std::size_t& ip);
+        void fail(std::size_t lane, const std::string& error, std::size_t ip);
+
+        void add(int offset, int value, std::size_t ip);
+        void move(int by, std::size_t ip);
+        void output(int offset, unsigned int repeat, std::size_t ip);
+        void input(int offset, std::size_t ip);
+        void set(int offset, int value, bool keep, std::size_t ip);
+        void multiply_add(int offset, int factor, std::size_t ip);
+        void scan(int stride, std::size_t ip);
+        void halt(std::size_t ip);
+
+        cells_t<std::vector<vector_t> > tape_;
+        vector_t alive_;                     // lanes that haven't failed
+        vector_t active_;                    // lanes running the current instruction
+        bool uniform_;                       // the running lanes are all at pc_
+        unsigned int pc_;
+        unsigned int pcs_[count];            // every lane's pc, when not uniform or not running
+        std::vector<frame_t> frames_;
+        std::vector<std::unique_ptr<io_t> > io_;
+        std::string errors_[count];
+        std::size_t at_[count];
+};
+
+template<typename C> lanes_t<C>::lanes_t(eof_t eof) : tape_(65536, vector_t()), uniform_(true), pc_(0)
+{
+        for (std::size_t lane = 0; lane != count; ++lane)
+                io_.push_back(std::unique_ptr<io_t>(new io_t(STDIN_FILENO, STDOUT_FILENO, FLUSH_Block, eof)));
+}
+
+template<typename C> void lanes_t<C>::run(const bytecode_t& bytecode, const prefix_t<C>& prefix, std::size_t used)
+{
+        tape_.reset();
+        frames_.clear();
+        alive_ = vector_t();
+
+        for (std::size_t lane = 0; lane != count; ++lane) {
+                errors_[lane].clear();
+                at_[lane] = 0;
+                pcs_[lane] = prefix.pointer;
+
+                if (lane < used)
+                        alive_[lane] = std::numeric_limits<cell_t>::max();
+        }
+
+        active_ = alive_;
+        uniform_ = true;
+        pc_ = prefix.pointer;
+
+        for (std::size_t i = 0; i != prefix.image.size(); ++i)
+                tape_[i] = splat(prefix.image[i]);
+
+        for (std::size_t lane = 0; lane != used; ++lane) {
+                try {
+                        for (std::size_t i = 0; i != prefix.output.size(); ++i)
+                                io(lane).put(prefix.output[i]);
+                }
+                catch (std::runtime_error& e) {
+                        fail(lane, e.what(), 0);
+                }
+        }
+
+        const std::vector<instruction_t>& code = bytecode.code;
+
+        for (std::size_t ip = 0; ; ++ip) {
+                if (!any_lane(active_) && !unwind(bytecode, ip))
+                        return;
+
+                const instruction_t& instruction = code[ip];
+
+                switch (instruction.opcode) {
+                case OP_Add:
+                        add(instruction.offset, instruction.operand, ip);
+                        break;
+                case OP_Move:
+                        move(instruction.operand, ip);
+                        break;
+                case OP_Output:
+                        output(instruction.offset, instruction.operand, ip);
+                        break;
+                case OP_Input:
+                        input(instruction.offset, ip);
+                        break;
+                case OP_Open:
+                        {
+                                vector_t entering = active_ & nonzero_lanes(current());
+
+                                if (!any_lane(entering))
+                                        ip = instruction.operand;
+                                else
+                                        diverge(entering, ip);
+                        }
+                        break;
+                case OP_Close:
+                        {
+                                vector_t staying = active_ & nonzero_lanes(current());
+
+                                if (any_lane(staying)) {
+                                        diverge(staying, instruction.operand);
+                                        ip = instruction.operand;
+                                }
+                                else if (!frames_.empty() && frames_.back().open == static_cast<std::size_t>(instruction.operand)) {
+                                        vector_t resuming = frames_.back().active & alive_;
+
+                                        frames_.pop_back();
+                                        regroup(resuming);
+                                }
+                        }
+                        break;
+                case OP_Clear:
+                        set(instruction.offset, 0, false, ip);
+                        break;
+                case OP_MulAdd:
+                        multiply_add(instruction.offset, instruction.operand, ip);
+                        break;
+                case OP_Scan:
+                        scan(instruction.operand, ip);
+                        break;
+                case OP_Set:
+                        set(instruction.offset, instruction.operand, true, ip);
+                        break;
+                case OP_Halt:
+                        halt(ip);
+                        return;
+                }
+        }
+}
+
+template<typename C> BF_ALWAYS_INLINE const char* lanes_t<C>::shift(unsigned int& pc, int by)
+{
+        if (by > 0 && static_cast<unsigned int>(by) > std::numeric_limits<unsigned int>::max() - pc)
+                return "pc overflow";
+
+        if (by < 0 && static_cast<unsigned int>(-by) > pc)
+                return "pc underflow";
+
+        pc += by;
+        return 0;
+}
+
+//! Index of the cell at offset from a lane's pc, failing the lane if there's none.
+template<typename C> bool lanes_t<C>::position(std::size_t lane, int offset, std::size_t ip, unsigned int& index)
+{
+        index = pcs_[lane];
+
+        if (const char* error = shift(index, offset)) {
+                fail(lane, error, ip);
+                return false;
+        }
+
+        return true;
+}
+
+//! As above, from the pc the running lanes share, failing all of them.
+template<typename C> BF_ALWAYS_INLINE bool lanes_t<C>::position(int offset, std::size_t ip, unsigned int& index)
+{
+        index = pc_;
+
+        if (const char* error = shift(index, offset)) {
+                for (std::size_t lane = 0; lane != count; ++lane)
+                        if (running(lane))
+                                fail(lane, error, ip);
+                return false;
+        }
+
+        return true;
+}
+
+//! The cell at the pc of every running lane, zero in the others.
+template<typename C> BF_ALWAYS_INLINE typename lanes_t<C>::vector_t lanes_t<C>::current()
+{
+        if (uniform_)
+                return tape_[pc_];
+
+        vector_t cells = vector_t();
+
+        for (std::size_t lane = 0; lane != count; ++lane)
+                if (running(lane))
+                        cells[lane] = cell(lane, pcs_[lane]);
+
+        return cells;
+}
+
+//! Runs only lanes through the rest of the loop at open, remembering which lanes to
+//  carry on with past it.
+template<typename C> BF_ALWAYS_INLINE void lanes_t<C>::diverge(vector_t lanes, std::size_t open)
+{
+        if (!any_lane(lanes ^ active_))
+                return;
+
+        if (frames_.empty() || frames_.back().open != open) {
+                frame_t frame = { active_, open };
+
+                frames_.push_back(frame);
+        }
+
+        regroup(lanes);
+}
+
+//! Runs lanes from here on, and finds out whether they share a pc.
+template<typename C> void lanes_t<C>::regroup(vector_t lanes)
+{
+        if (!any_lane(lanes ^ active_))
+                return;
+
+        if (uniform_)
+                for (std::size_t lane = 0; lane != count; ++lane)
+                        if (running(lane))
+                                pcs_[lane] = pc_;
+
+        active_ = lanes;
+        uniform_ = true;
+
+        bool first = true;
+
+        for (std::size_t lane = 0; lane != count; ++lane) {
+                if (!running(lane))
+                        continue;
+
+                if (first)
+                        pc_ = pcs_[lane];
+                else if (pcs_[lane] != pc_)
+                        uniform_ = false;
+
+                first = false;
+        }
+}
+
+//! Every lane in the innermost loops failed - leaves those for the lanes waiting at
+//  their end. Returns false once no lane is left.
+template<typename C> bool lanes_t<C>::unwind(const bytecode_t& bytecode, std::size_t& ip)
+{
+        while (!frames_.empty()) {
+                frame_t frame = frames_.back();
+
+                frames_.pop_back();
+                regroup(frame.active & alive_);
+
+                if (any_lane(active_)) {
+                        ip = bytecode.code[frame.open].operand + 1;
+                        return true;
+                }
+        }
+
+        return false;
+}
+
+template<typename C> void lanes_t<C>::fail(std::size_t lane, const std::string& error, std::size_t ip)
+{
+        errors_[lane] = error;
+        at_[lane] = ip;
+
+        alive_[lane] = 0;
+        active_[lane] = 0;
+
+        for (std::size_t i = 0; i != frames_.size(); ++i)
+                frames_[i].active[lane] = 0;
+
+        io(lane).flush_quietly();
+}
+
+template<typename C> BF_ALWAYS_INLINE void lanes_t<C>::add(int offset, int value, std::size_t ip)
+{
+        unsigned int index;
+
+        if (uniform_) {
+                if (position(offset, ip, index))
+                        tape_[index] += splat(value) & active_;
+                return;
+        }
+
+        for (std::size_t lane = 0; lane != count; ++lane)
+                if (running(lane) && position(lane, offset, ip, index))
+                        cell(lane, index) += static_cast<cell_t>(value);
+}
+
+template<typename C> BF_ALWAYS_INLINE void lanes_t<C>::move(int by, std::size_t ip)
+{
+        if (uniform_) {
+                if (const char* error = shift(pc_, by))
+                        for (std::size_t lane = 0; lane != count; ++lane)
+                                if (running(lane))
+                                        fail(lane, error, ip);
+                return;
+        }
+
+        for (std::size_t lane = 0; lane != count; ++lane)
+                if (running(lane))
+                        if (const char* error = shift(pcs_[lane], by))
+                                fail(lane, error, ip);
+}
+
+template<typename C> void lanes_t<C>::output(int offset, unsigned int repeat, std::size_t ip)
+{
+        unsigned int index;
+
+        for (std::size_t lane = 0; lane != count; ++lane) {
+                if (!running(lane))
+                        continue;
+
+                if (uniform_ ? !position(offset, ip, index) : !position(lane, offset, ip, index))
+                        continue;
+
+                try {
+                        io(lane).put(static_cast<C>(cell(lane, index)), repeat);
+                }
+                catch (std::runtime_error& e) {
+                        fail(lane, e.what(), ip);
+                }
+        }
+}
+
+template<typename C> void lanes_t<C>::input(int offset, std::size_t ip)
+{
+        unsigned int index;
+
+        for (std::size_t lane = 0; lane != count; ++lane) {
+                if (!running(lane))
+                        continue;
+
+                if (uniform_ ? !position(offset, ip, index) : !position(lane, offset, ip, index))
+                        continue;
+
+                C value = static_cast<C>(cell(lane, index));
+
+                try {
+                        io(lane).get(value);
+                }
+                catch (std::runtime_error& e) {
+                        fail(lane, e.what(), ip);
+                        continue;
+                }
+
+                cell(lane, index) = static_cast<cell_t>(value);
+        }
+}
+
+//! Clear, and Set when keep is true.
+template<typename C> BF_ALWAYS_INLINE void lanes_t<C>::set(int offset, int value, bool keep, std::size_t ip)
+{
+        unsigned int index;
+
+        if (uniform_) {
+                if (position(offset, ip, index)) {
+                        vector_t& cells = tape_[index];
+
+                        cells = (cells & ~active_) | (keep ? splat(value) & active_ : vector_t());
+                }
+                return;
+        }
+
+        for (std::size_t lane = 0; lane != count; ++lane)
+                if (running(lane) && position(lane, offset, ip, index))
+                        cell(lane, index) = static_cast<cell_t>(value);
+}
+
+template<typename C> BF_ALWAYS_INLINE void lanes_t<C>::multiply_add(int offset, int factor, std::size_t ip)
+{
+        unsigned int index;
+
+        if (uniform_) {
+                vector_t induction = tape_[pc_] & active_;
+
+                //! The loop this came from wouldn't have run on a zero cell, only the
+                //  lanes it would have run for can fall off the tape.
+                if (offset < 0 && static_cast<unsigned int>(-offset) > pc_) {
+                        vector_t stepping = nonzero_lanes(induction) & active_;
+
+                        for (std::size_t lane = 0; lane != count; ++lane)
+                                if (stepping[lane])
+                                        fail(lane, "pc underflow", ip);
+                        return;
+                }
+
+                tape_[pc_ + offset] += induction * static_cast<cell_t>(factor);
+                return;
+        }
+
+        for (std::size_t lane = 0; lane != count; ++lane) {
+                if (!running(lane))
+                        continue;
+
+                if (cell_t induction = cell(lane, pcs_[lane]))
+                        if (position(lane, offset, ip, index))
+                                wrap_policy_t::multiply_add(cell(lane, index), induction, factor);
+        }
+}
+
+//! Lanes that share a pc step together, dropping out as they reach a zero cell,
+//  otherwise each lane scans on its own. Either way they likely end up apart.
+template<typename C> void lanes_t<C>::scan(int stride, std::size_t ip)
+{
+        if (uniform_) {
+                vector_t moving = active_;
+                unsigned int position = pc_;
+
+                for (;;) {
+                        vector_t stopping = moving & ~nonzero_lanes(position < tape_.size() ? tape_[position] : vector_t());
+
+                        if (any_lane(stopping)) {
+                                if (!any_lane(stopping ^ active_)) {
+                                        pc_ = position;
+                                        return;
+                                }
+
+                                for (std::size_t lane = 0; lane != count; ++lane)
+                                        if (stopping[lane])
+                                                pcs_[lane] = position;
+
+                                moving &= ~stopping;
+
+                                if (!any_lane(moving))
+                                        break;
+                        }
+
+                        if (const char* error = shift(position, stride)) {
+                                for (std::size_t lane = 0; lane != count; ++lane)
+                                        if (moving[lane])
+                                                fail(lane, error, ip);
+                                break;
+                        }
+                }
+        }
+        else {
+                for (std::size_t lane = 0; lane != count; ++lane) {
+                        if (!running(lane))
+                                continue;
+
+                        while (pcs_[lane] < tape_.size() && cell(lane, pcs_[lane]) != 0) {
+                                if (const char* error = shift(pcs_[lane], stride)) {
+                                        fail(lane, error, ip);
+                                        break;
+                                }
+                        }
+                }
+        }
+
+        vector_t lanes = active_;
+
+        //! Forces regroup to look at the pcs again.
+        active_ = vector_t();
+        uniform_ = false;
+        regroup(lanes);
+}
+
+template<typename C> void lanes_t<C>::halt(std::size_t ip)
+{
+        for (std::size_t lane = 0; lane != count; ++lane) {
+                if (!alive_[lane])
+                        continue;
+
+                try {
+                        io(lane).flush();
+                }
+                catch (std::runtime_error& e) {
+                        fail(lane, e.what(), ip);
+                }
+        }
+}
+
+} // namespace detail
+
+#endif /* _H_BF_LANES */
\ No newline at end of file
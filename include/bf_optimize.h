@@ -20,40 +20,56 @@
 #define _H_BF_OPTIMIZE
 
 #include "bf_cells.h"
+#include "bf_syntax.h"
+#include "bf_bytecode.h"
 
-#include <stdexcept>
+#include <algorithm>
+#include <string>
 #include <vector>
 #include <cstring>
 
 namespace detail {
 
-//! finds the matching ']' for a '['
-unsigned int track_forward(const char* program, unsigned int command_index, unsigned int bound)
+//! The commands the evaluator steps through, without what it would only step over -
+//  whitespace, and anything else that isn't a command when unknowns are ignored - so
+//  no loop dispatches on it. Each command's position in the source is kept for
+//  reporting, the end of the source last.
+struct command_stream_t {
+        command_stream_t(const char* program, size_t program_size, bool ignore_unknowns);
+
+        unsigned int index_of(unsigned int position) const;  // the command at position or after it
+
+        std::string commands;
+        std::vector<unsigned int> positions;
+};
+
+inline command_stream_t::command_stream_t(const char* program, size_t program_size, bool ignore_unknowns)
 {
-        unsigned int i = command_index;
-        unsigned int op_count = 0;
+        commands.reserve(program_size);
+        positions.reserve(program_size + 1);
 
-        while (i != bound) {
-                switch (program[i]) {
-                case ']': --op_count; break;
-                case '[': ++op_count; break;
-                }
+        for (unsigned int i = 0; i != program_size; ++i) {
+                if (is_skippable(program[i], ignore_unknowns))
+                        continue;
 
-                if (op_count == 0)
-                        return i;
-                ++i;
+                commands.push_back(program[i]);
+                positions.push_back(i);
         }
 
-        throw std::runtime_error("can't find corresponding command");
-        return 0;
+        positions.push_back(static_cast<unsigned int>(program_size));
+}
+
+inline unsigned int command_stream_t::index_of(unsigned int position) const
+{
+        return static_cast<unsigned int>(std::lower_bound(positions.begin(), positions.end(), position) - positions.begin());
 }
 
 inline unsigned int repetition_length(const char* program, size_t program_size, unsigned int command_index, char command)
 {
         unsigned int length = 0;
 
-        while (program[command_index++] == command && ++length) {
-        }
+        while (command_index + length != program_size && program[command_index + length] == command)
+                ++length;
 
         return length;
 }
@@ -87,16 +103,18 @@ inline bool is_composite_command(const char* program, size_t program_size, unsig
 }
 
 //! Optimizes composite and repeated commands. Creates a jump table for corresponding
-//  '[' and ']' commands.
+//  '[' and ']' commands, pairing them up in the same pass.
 void optimize(const char* program, size_t program_size, optimizations_table& table)
 {
+        bracket_matcher_t brackets;
         unsigned int command_index = 0;
 
         while (command_index != program_size) {
                 switch (program[command_index]) {
-                case ' ':
-                case '\n':
-                        break;
+                default:
+                        //! Whatever isn't a command is left to the evaluator.
+                        command_index = static_cast<unsigned int>(next_command(program, program_size, command_index + 1));
+                        continue;
                 case '>':
                         command_index += (table[command_index] = repetition_length(
                                 program
@@ -129,6 +147,14 @@ void optimize(const char* program, size_t program_size, optimizations_table& tab
                               , '-'
                         ));
                         continue;
+                case '.':
+                        command_index += (table[command_index] = repetition_length(
+                                program
+                              , program_size
+                              , command_index
+                              , '.'
+                        ));
+                        continue;
                 case '[':
                         //! Cell clear.
                         if (is_composite_command(program, program_size, command_index, CC_Clear.command, CC_Clear.command_length)) {
@@ -144,14 +170,24 @@ void optimize(const char* program, size_t program_size, optimizations_table& tab
                                 continue;
                         }
 
-                        //! Find the matching ']'
-                        table[command_index] = track_forward(program, command_index, program_size);
-                        table[table[command_index]] = command_index;
-                        break;                      
+                        //! The matching ']' fills in both entries.
+                        brackets.open(command_index, command_index);
+                        break;
+                case ']': {
+                        std::size_t open;
+
+                        if (brackets.close(command_index, open)) {
+                                table[open] = command_index;
+                                table[command_index] = static_cast<int>(open);
+                        }
+                        break;
+                }
                 }
 
                 ++command_index;
         }
+
+        brackets.finish();
 }
 
 } // namespace detail
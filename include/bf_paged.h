@@ -0,0 +1,244 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_PAGED
+#define _H_BF_PAGED
+
+#include "bf_cells.h"
+#include "bf_scan.h"
+#include "bf_inline.h"
+
+#include <stdexcept>
+#include <cstddef>
+
+namespace detail {
+
+const std::size_t paged_page_bits = 12;                 // cells in a page
+const std::size_t paged_table_bits = 10;                // pages in a table
+const std::size_t paged_directory_bits = 32 - paged_page_bits - paged_table_bits;   // tables, enough for any pc
+
+//! Cell storage for programs that wander far - a two level directory of fixed size
+//  pages. Pages never written to are one shared page of zeroes, a page gets a copy
+//  of its own on the first write, so memory goes with the pages written rather than
+//  with how far apart they are. Reads never allocate.
+template<typename C> struct paged_storage_t {
+        typedef C           value_type;
+        typedef std::size_t size_type;
+
+        static const size_type page_cells = size_type(1) << paged_page_bits;
+
+        explicit paged_storage_t(size_type init_size = 0, C initial = 0);
+        ~paged_storage_t();
+
+        C&       operator [](size_type index);
+        C const& operator [](size_type index) const { return page(index)[index & (page_cells - 1)]; }
+
+        void resize(size_type, C) {}
+        size_type size() const { return pages_ * page_cells; }   // cells in the pages written to
+        size_type end() const { return top_ * page_cells; }      // one past the highest page written to
+
+        void reset();                        // every page given back
+
+        //! The page index is on.
+        const C* page(size_type index) const {
+                return directory_[index >> (paged_page_bits + paged_table_bits)]->pages[(index >> paged_page_bits) & (table_pages - 1)];
+        }
+
+        bool written(size_type index) const { return page(index) != zero_; }
+
+private:
+        paged_storage_t(const paged_storage_t&);
+        paged_storage_t& operator =(const paged_storage_t&);
+
+        static const size_type table_pages = size_type(1) << paged_table_bits;
+        static const size_type directory_tables = size_type(1) << paged_directory_bits;
+
+        struct table_t {
+                C* pages[table_pages];
+        };
+
+        static C* zero_page() { return const_cast<C*>(zero_); }
+        static table_t* zero_table();
+
+        C* copy(size_type index);
+
+        static const C zero_[page_cells];
+
+        table_t* directory_[directory_tables];
+        size_type pages_;
+        size_type top_;                      // pages up to the highest written to
+};
+
+template<typename C> const C paged_storage_t<C>::zero_[paged_storage_t<C>::page_cells] = {};
+
+template<typename C> paged_storage_t<C>::paged_storage_t(size_type, C initial) : pages_(0), top_(0)
+{
+        if (initial != 0)
+                throw std::runtime_error("paged tapes start out zeroed");
+
+        for (size_type i = 0; i != directory_tables; ++i)
+                directory_[i] = zero_table();
+}
+
+template<typename C> paged_storage_t<C>::~paged_storage_t()
+{
+        reset();
+}
+
+template<typename C> BF_ALWAYS_INLINE C& paged_storage_t<C>::operator [](size_type index)
+{
+        C* page = const_cast<C*>(this->page(index));
+
+        if (page == zero_page())
+                page = copy(index);
+
+        return page[index & (page_cells - 1)];
+}
+
+//! Shared by every tape, its pages all the zero page. Never written to.
+template<typename C> typename paged_storage_t<C>::table_t* paged_storage_t<C>::zero_table()
+{
+        static table_t* table = [] {
+                static table_t zero;
+
+                for (size_type i = 0; i != table_pages; ++i)
+                        zero.pages[i] = zero_page();
+
+                return &zero;
+        }();
+
+        return table;
+}
+
+//! Gives the page index is on a copy of its own, and its table if need be.
+template<typename C> C* paged_storage_t<C>::copy(size_type index)
+{
+        table_t*& table = directory_[index >> (paged_page_bits + paged_table_bits)];
+
+        if (table == zero_table())
+                table = new table_t(*zero_table());
+
+        C*& page = table->pages[(index >> paged_page_bits) & (table_pages - 1)];
+
+        page = new C[page_cells]();
+        ++pages_;
+
+        if ((index >> paged_page_bits) >= top_)
+                top_ = (index >> paged_page_bits) + 1;
+
+        return page;
+}
+
+template<typename C> void paged_storage_t<C>::reset()
+{
+        for (size_type i = 0; i != directory_tables; ++i) {
+                if (directory_[i] == zero_table())
+                        continue;
+
+                for (size_type j = 0; j != table_pages; ++j)
+                        if (directory_[i]->pages[j] != zero_page())
+                                delete[] directory_[i]->pages[j];
+
+                delete directory_[i];
+                directory_[i] = zero_table();
+        }
+
+        pages_ = 0;
+        top_ = 0;
+}
+
+//! Paged storage indexes any pc without growing, and isn't in one piece - there's
+//  no data().
+template<typename C> struct cells_t<paged_storage_t<C> > {
+        explicit cells_t(unsigned int init_size = 0, C initial = 0) : cells_(init_size, initial) {
+        }
+
+        C&       operator [](unsigned int index)       { return cells_[index]; }
+        C const& operator [](unsigned int index) const { return cells_[index]; }
+
+        std::size_t size() const { return cells_.size(); }
+        std::size_t end() const { return cells_.end(); }
+        void reset() { cells_.reset(); }
+
+        const C* page(unsigned int index) const { return cells_.page(index); }
+        bool written(unsigned int index) const { return cells_.written(index); }
+
+private:
+        paged_storage_t<C> cells_;
+};
+
+template<typename C> struct tape_contiguous<paged_storage_t<C> > {
+        static const bool value = false;
+};
+
+//! Looks at the pages written to only, from the highest down - size() counts them,
+//  it doesn't bound the cells.
+template<typename C> std::size_t written_extent(const cells_t<paged_storage_t<C> >& cells)
+{
+        const std::size_t page_cells = paged_storage_t<C>::page_cells;
+
+        for (std::size_t end = cells.end(); end != 0; end -= page_cells) {
+                if (!cells.written(static_cast<unsigned int>(end - 1)))
+                        continue;
+
+                const C* page = cells.page(static_cast<unsigned int>(end - 1));
+
+                for (std::size_t i = page_cells; i != 0; --i)
+                        if (page[i - 1] != 0)
+                                return end - page_cells + i;
+        }
+
+        return 0;
+}
+
+//! Scans a page at a time, carrying on from where the scan left the page.
+template<typename C> std::ptrdiff_t scan_cells(const cells_t<paged_storage_t<C> >& cells, std::ptrdiff_t position, int stride)
+{
+        const std::ptrdiff_t page_cells = paged_storage_t<C>::page_cells;
+        const std::ptrdiff_t end = std::ptrdiff_t(1) << 32;
+
+        while (position >= 0 && position < end) {
+                std::ptrdiff_t start = position & ~(page_cells - 1);
+                const C* page = cells.page(static_cast<unsigned int>(position));
+
+                if (stride > 0) {
+                        std::ptrdiff_t found = scan_forward(page, page_cells, position - start, stride);
+
+                        if (found < page_cells)
+                                return start + found;
+
+                        position = start + found;
+                }
+                else {
+                        std::ptrdiff_t offset = position - start;
+                        std::ptrdiff_t found = scan_backward(page, page_cells, offset, -stride);
+
+                        if (found >= 0)
+                                return start + found;
+
+                        position = start + offset % -stride + stride;
+                }
+        }
+
+        return position;
+}
+
+} // namespace detail
+
+#endif /* _H_BF_PAGED */
\ No newline at end of file
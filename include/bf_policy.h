@@ -0,0 +1,129 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_POLICY
+#define _H_BF_POLICY
+
+#include "bf_inline.h"
+
+#include <type_traits>
+#include <stdexcept>
+#include <limits>
+
+namespace detail {
+
+//! Overflow policies - what happens when a cell goes past its limits. Besides
+//  adding, each handles the composite instructions that stand in for a loop
+//  counting the current cell (the induction cell) down to zero.
+
+//! A signed type that holds a cell plus any induction cell times a factor, for the
+//  policies that check the result of a multiply-add rather than each step of it.
+template<typename C> struct wide_of {
+        typedef typename std::conditional<(sizeof(C) < sizeof(long long)), long long, __int128>::type type;
+};
+
+//! Cells wrap around, arithmetic is done on the unsigned counterpart so that it
+//  compiles to a plain add. Narrow cells are multiplied as unsigned int, they would
+//  be promoted to int and could overflow it.
+struct wrap_policy_t {
+        static const bool wraps = true;
+
+        template<typename C> BF_ALWAYS_INLINE static void add(C& cell, int value) {
+                typedef typename std::make_unsigned<C>::type U;
+                cell = static_cast<C>(static_cast<U>(cell) + static_cast<U>(value));
+        }
+
+        template<typename C> BF_ALWAYS_INLINE static void multiply_add(C& cell, C induction, int factor) {
+                typedef typename std::make_unsigned<C>::type U;
+                typedef typename std::common_type<U, unsigned int>::type M;
+                cell = static_cast<C>(static_cast<U>(static_cast<M>(static_cast<U>(cell)) + static_cast<M>(static_cast<U>(induction)) * static_cast<M>(static_cast<U>(factor))));
+        }
+
+        template<typename C> BF_ALWAYS_INLINE static void count_down(C) {
+        }
+};
+
+//! Going past a limit is an error.
+struct trap_policy_t {
+        static const bool wraps = false;
+
+        template<typename C> BF_ALWAYS_INLINE static void add(C& cell, int value) {
+                if (__builtin_add_overflow(cell, value, &cell))
+                        throw std::runtime_error(value > 0 ? "cell overflow" : "cell underflow");
+        }
+
+        //! The loop moves the cell the same way every step, so it only goes past a
+        //  limit if the result does.
+        template<typename C> BF_ALWAYS_INLINE static void multiply_add(C& cell, C induction, int factor) {
+                typedef typename wide_of<C>::type W;
+
+                count_down(induction);
+
+                W result = static_cast<W>(cell) + static_cast<W>(induction) * factor;
+
+                if (result > static_cast<W>(std::numeric_limits<C>::max()))
+                        throw std::runtime_error("cell overflow");
+                if (result < static_cast<W>(std::numeric_limits<C>::min()))
+                        throw std::runtime_error("cell underflow");
+
+                cell = static_cast<C>(result);
+        }
+
+        //! A negative induction cell is decremented until it underflows.
+        template<typename C> BF_ALWAYS_INLINE static void count_down(C induction) {
+                if (induction < 0)
+                        throw std::runtime_error("cell underflow");
+        }
+};
+
+//! Cells stick at their limits.
+struct saturate_policy_t {
+        static const bool wraps = false;
+
+        template<typename C> BF_ALWAYS_INLINE static void add(C& cell, int value) {
+                if (__builtin_add_overflow(cell, value, &cell))
+                        cell = value > 0 ? std::numeric_limits<C>::max() : std::numeric_limits<C>::min();
+        }
+
+        //! Once at a limit the loop keeps pushing the cell against it, so the result
+        //  is the exact one clamped.
+        template<typename C> BF_ALWAYS_INLINE static void multiply_add(C& cell, C induction, int factor) {
+                typedef typename wide_of<C>::type W;
+
+                count_down(induction);
+
+                W result = static_cast<W>(cell) + static_cast<W>(induction) * factor;
+
+                if (result > static_cast<W>(std::numeric_limits<C>::max()))
+                        cell = std::numeric_limits<C>::max();
+                else if (result < static_cast<W>(std::numeric_limits<C>::min()))
+                        cell = std::numeric_limits<C>::min();
+                else
+                        cell = static_cast<C>(result);
+        }
+
+        //! A negative induction cell sticks at the minimum and never reaches zero.
+        template<typename C> BF_ALWAYS_INLINE static void count_down(C induction) {
+                if (induction < 0)
+                        throw std::runtime_error("loop never terminates");
+        }
+};
+
+} // namespace detail
+
+#endif /* _H_BF_POLICY */
\ No newline at end of file
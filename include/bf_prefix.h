@@ -0,0 +1,222 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_PREFIX
+#define _H_BF_PREFIX
+
+#include "bf_bytecode.h"
+#include "bf_state.h"
+#include "bf_io.h"
+
+#include <stdint.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace detail {
+
+const std::size_t fold_budget = std::size_t(1) << 18;        // instructions run ahead at most
+const std::size_t fold_output_limit = std::size_t(1) << 16;  // bytes of output kept as a literal
+const std::size_t fold_tape_limit = std::size_t(1) << 20;    // cells kept as an image
+
+//! What the start of a program leaves behind when it doesn't depend on input: the
+//  cells from the origin on (the rest are zero), where the pc points relative to
+//  the origin, the output written so far and the back-edges taken to get there,
+//  which a budget is charged for before the run carries on.
+template<typename C> struct prefix_t {
+        prefix_t() : pointer(0), steps(0) {
+        }
+
+        std::vector<C> image;
+        unsigned int pointer;
+        std::string output;
+        uint64_t steps;
+};
+
+//! Instructions a program can be resumed at - outside of every loop, a loop's '['
+//  included, so no jump crosses them.
+inline std::vector<bool> resume_points(const bytecode_t& bytecode)
+{
+        std::vector<bool> points(bytecode.code.size());
+        int depth = 0;
+
+        for (std::size_t i = 0; i != bytecode.code.size(); ++i) {
+                if (bytecode.code[i].opcode == OP_Close)
+                        --depth;
+                else
+                        points[i] = depth == 0;
+
+                if (bytecode.code[i].opcode == OP_Open)
+                        ++depth;
+        }
+
+        return points;
+}
+
+//! Runs the bytecode from a zeroed tape until it reads input, halts, fails, runs
+//  budget instructions or outgrows the limits. Returns how many instructions ran
+//  before the last resume point it passed and sets resume to that point - the
+//  run is only a clean prefix when it stopped right there. steps counts the
+//  back-edges taken.
+template<typename C, typename P>
+std::size_t run_ahead(const bytecode_t& bytecode, const std::vector<bool>& points, std::size_t budget,
+                      state_t<unsigned int, std::vector<C>, P>& state, std::string& output, std::size_t& resume, bool& clean,
+                      uint64_t& steps)
+{
+        std::size_t ran = 0;
+        std::size_t last = 0;
+        std::size_t i = 0;
+
+        resume = 0;
+        clean = false;
+        steps = 0;
+
+        try {
+                for (;; ++ran, ++i) {
+                        const instruction_t& instruction = bytecode.code[i];
+
+                        if (points[i]) {
+                                last = ran;
+                                resume = i;
+                        }
+
+                        if (ran == budget || output.size() >= fold_output_limit || state.cell_count() >= fold_tape_limit)
+                                break;
+
+                        switch (instruction.opcode) {
+                        case OP_Add:
+                                state.add(instruction.offset, instruction.operand);
+                                continue;
+                        case OP_Move:
+                                if (instruction.operand > 0)
+                                        state.increment_pc(instruction.operand);
+                                else
+                                        state.decrement_pc(-instruction.operand);
+                                continue;
+                        case OP_Output:
+                                output.append(instruction.operand, static_cast<char>(state.get(instruction.offset)));
+                                continue;
+                        case OP_Open:
+                                if (state.get() == 0)
+                                        i = instruction.operand;
+                                continue;
+                        case OP_Close:
+                                if (state.get() != 0) {
+                                        i = instruction.operand;
+                                        ++steps;
+                                }
+                                continue;
+                        case OP_Clear:
+                                state.clear(instruction.offset);
+                                continue;
+                        case OP_MulAdd:
+                                state.multiply_add(instruction.offset, instruction.operand);
+                                continue;
+                        case OP_Scan:
+                                state.scan(instruction.operand);
+                                continue;
+                        case OP_Set:
+                                state.set(instruction.offset) = static_cast<C>(instruction.operand);
+                                continue;
+                        }
+
+                        //! Input or the end.
+                        break;
+                }
+        }
+        catch (std::runtime_error&) {
+                //! Left for the engine to run into and report.
+                return last;
+        }
+
+        clean = ran == last;
+        return last;
+}
+
+//! Keeps the cells up to the last one that isn't zero and the pc.
+template<typename C, typename P>
+void fold_image(const state_t<unsigned int, std::vector<C>, P>& state, prefix_t<C>& prefix)
+{
+        std::size_t size = state.cell_count();
+
+        while (size != 0 && state.at(size - 1) == 0)
+                --size;
+
+        prefix.image.resize(size);
+
+        for (std::size_t i = 0; i != size; ++i)
+                prefix.image[i] = state.at(i);
+
+        prefix.pointer = state.pc();
+}
+
+//! Partial evaluation - runs the part of the program that doesn't depend on input
+//  ahead of time under overflow policy P and drops it from the bytecode, leaving
+//  what it computed in prefix. The bytecode resumes outside of any loop, so a
+//  program that is one big loop keeps all of it. The run is repeated up to the
+//  resume point when it stopped elsewhere, it's deterministic.
+template<typename C, typename P>
+void fold_prefix(bytecode_t& bytecode, prefix_t<C>& prefix)
+{
+        std::vector<bool> points = resume_points(bytecode);
+        std::size_t resume;
+        bool clean;
+
+        state_t<unsigned int, std::vector<C>, P> state;
+        std::size_t ran = run_ahead<C, P>(bytecode, points, fold_budget, state, prefix.output, resume, clean, prefix.steps);
+
+        if (resume == 0) {
+                prefix.output.clear();
+                prefix.steps = 0;
+                return;
+        }
+
+        if (!clean) {
+                state_t<unsigned int, std::vector<C>, P> again;
+
+                prefix.output.clear();
+                run_ahead<C, P>(bytecode, points, ran, again, prefix.output, resume, clean, prefix.steps);
+                fold_image(again, prefix);
+        }
+        else
+                fold_image(state, prefix);
+
+        for (std::size_t i = resume; i != bytecode.code.size(); ++i)
+                if (bytecode.code[i].opcode == OP_Open || bytecode.code[i].opcode == OP_Close)
+                        bytecode.code[i].operand -= static_cast<int>(resume);
+
+        bytecode.code.erase(bytecode.code.begin(), bytecode.code.begin() + resume);
+        bytecode.positions.erase(bytecode.positions.begin(), bytecode.positions.begin() + resume);
+}
+
+//! Brings an interpreter's state and output to where the folded prefix left off.
+template<typename C, typename T, typename S, typename P>
+void restore_prefix(const prefix_t<C>& prefix, state_t<T, S, P>& state, io_t& io)
+{
+        state.load(prefix.image, prefix.pointer);
+
+        for (std::size_t i = 0; i != prefix.output.size(); ++i)
+                io.put(prefix.output[i]);
+}
+
+} // namespace detail
+
+#endif /* _H_BF_PREFIX */
\ No newline at end of file
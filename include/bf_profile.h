@@ -0,0 +1,222 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_PROFILE
+#define _H_BF_PROFILE
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <stdint.h>
+
+namespace detail {
+
+//! What became of a loop.
+enum loop_kind_t {
+        LOOP_Plain
+      , LOOP_Clear                   // [-]
+      , LOOP_MulAdd                  // [->+<] and friends, multiply-adds and a clear
+      , LOOP_Scan                    // [>]
+};
+
+//! What the engines report to as they run. An engine calls compiled() once its front
+//  end is done and finished() with the size of the tape once the program stops;
+//  with enabled set it also reports every instruction and loop as it executes.
+//  This one records nothing, the calls compile away.
+struct no_recorder_t {
+        static const bool enabled = false;
+
+        void executed(unsigned int) {}
+        void loop(unsigned int, loop_kind_t, uint64_t) {}
+        void entered(unsigned int) {}
+        void iterated(unsigned int) {}
+
+        void compiled() {}
+        void finished(std::size_t) {}
+};
+
+//! Execution counts gathered by an engine instantiated with profiling on. Everything
+//  is keyed by source position, loops by the position of their '[' - an engine
+//  that fuses a loop reports it under the same key as one that runs it.
+struct profile_t {
+        static const bool enabled = true;
+
+        explicit profile_t(std::size_t program_size);
+
+        void executed(unsigned int position)  { ++executions_[position]; }
+
+        //! The loop at position was reached, and its body ran iterations times -
+        //  all at once for a fused loop, one by one (entered/iterated) otherwise.
+        void loop(unsigned int position, loop_kind_t kind, uint64_t iterations);
+        void entered(unsigned int position)   { ++loops_[position].entries; }
+        void iterated(unsigned int position)  { ++loops_[position].iterations; }
+
+        void compiled() {}
+        void finished(std::size_t) {}
+
+        //! Ranked report of the hottest loops and commands.
+        void report(std::ostream& out, const char* program, std::size_t program_size, std::size_t limit = 20) const;
+
+private:
+        struct loop_t {
+                loop_t() : entries(0), iterations(0), kind(LOOP_Plain) {
+                }
+
+                uint64_t entries;
+                uint64_t iterations;
+                loop_kind_t kind;
+        };
+
+        std::vector<uint64_t> executions_;
+        std::vector<loop_t> loops_;
+};
+
+inline profile_t::profile_t(std::size_t program_size) : executions_(program_size + 1), loops_(program_size + 1)
+{
+}
+
+inline void profile_t::loop(unsigned int position, loop_kind_t kind, uint64_t iterations)
+{
+        loop_t& loop = loops_[position];
+
+        ++loop.entries;
+        loop.iterations += iterations;
+        loop.kind = kind;
+}
+
+inline const char* loop_kind_name(loop_kind_t kind)
+{
+        switch (kind) {
+        case LOOP_Clear:  return "clear";
+        case LOOP_MulAdd: return "multiply-add";
+        case LOOP_Scan:   return "scan";
+        case LOOP_Plain:  break;
+        }
+
+        return "loop";
+}
+
+//! The source from position on, up to the matching ']' or width characters, on one line.
+inline std::string source_excerpt(const char* program, std::size_t program_size, std::size_t position, std::size_t width = 40)
+{
+        std::string excerpt;
+        int depth = 0;
+
+        for (std::size_t i = position; i != program_size && excerpt.size() != width; ++i) {
+                char command = program[i];
+
+                if (command == '\n' || command == '\t')
+                        command = ' ';
+
+                excerpt += command;
+
+                if (command == '[')
+                        ++depth;
+                else if (command == ']' && --depth <= 0)
+                        break;
+        }
+
+        return excerpt;
+}
+
+//! Orders positions by a count, highest first.
+struct hotter_t {
+        explicit hotter_t(const std::vector<uint64_t>& counts) : counts(counts) {
+        }
+
+        bool operator ()(unsigned int a, unsigned int b) const {
+                return counts[a] != counts[b] ? counts[a] > counts[b] : a < b;
+        }
+
+        const std::vector<uint64_t>& counts;
+};
+
+inline void profile_t::report(std::ostream& out, const char* program, std::size_t program_size, std::size_t limit) const
+{
+        std::vector<uint64_t> iterations(loops_.size());
+        std::vector<unsigned int> loops, commands;
+        uint64_t total = 0;
+
+        for (std::size_t i = 0; i != executions_.size(); ++i) {
+                total += executions_[i];
+                iterations[i] = loops_[i].iterations;
+
+                if (loops_[i].entries)
+                        loops.push_back(static_cast<unsigned int>(i));
+                if (executions_[i])
+                        commands.push_back(static_cast<unsigned int>(i));
+        }
+
+        std::sort(loops.begin(), loops.end(), hotter_t(iterations));
+        std::sort(commands.begin(), commands.end(), hotter_t(executions_));
+
+        //! Line and column of every position, in one pass.
+        std::vector<unsigned int> lines(program_size + 1), columns(program_size + 1);
+
+        for (std::size_t i = 0, line = 1, column = 1; i <= program_size; ++i) {
+                lines[i] = static_cast<unsigned int>(line);
+                columns[i] = static_cast<unsigned int>(column);
+
+                if (i != program_size && program[i] == '\n') {
+                        ++line;
+                        column = 1;
+                }
+                else {
+                        ++column;
+                }
+        }
+
+        out<<"Profile: "<<total<<" instructions executed, "<<loops.size()<<" loops reached"<<std::endl<<std::endl;
+
+        out<<"Hottest loops:"<<std::endl
+           <<"  rank   line:col        iterations      entries  kind          source"<<std::endl;
+
+        for (std::size_t i = 0; i != loops.size() && i != limit; ++i) {
+                const loop_t& loop = loops_[loops[i]];
+                std::ostringstream location;
+
+                location<<lines[loops[i]]<<':'<<columns[loops[i]];
+
+                out<<std::setw(6)<<i + 1<<"   "<<std::left<<std::setw(10)<<location.str()<<std::right
+                   <<std::setw(16)<<loop.iterations<<std::setw(13)<<loop.entries<<"  "
+                   <<std::left<<std::setw(14)<<loop_kind_name(loop.kind)<<std::right
+                   <<source_excerpt(program, program_size, loops[i])<<std::endl;
+        }
+
+        out<<std::endl<<"Hottest instructions:"<<std::endl
+           <<"  rank   line:col        executions  share   source"<<std::endl;
+
+        for (std::size_t i = 0; i != commands.size() && i != limit; ++i) {
+                std::ostringstream location, share;
+
+                location<<lines[commands[i]]<<':'<<columns[commands[i]];
+                share<<std::fixed<<std::setprecision(1)<<100.0 * executions_[commands[i]] / total<<'%';
+
+                out<<std::setw(6)<<i + 1<<"   "<<std::left<<std::setw(10)<<location.str()<<std::right
+                   <<std::setw(16)<<executions_[commands[i]]<<std::setw(7)<<share.str()<<"   "
+                   <<source_excerpt(program, program_size, commands[i], 20)<<std::endl;
+        }
+}
+
+} // namespace detail
+
+#endif /* _H_BF_PROFILE */
\ No newline at end of file
@@ -0,0 +1,237 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_PROGRAM
+#define _H_BF_PROGRAM
+
+#include "bf_threaded.h"
+#include "bf_tiered.h"
+#include "bf_bytecode.h"
+#include "bf_syntax.h"
+#include "bf_prefix.h"
+#include "bf_policy.h"
+#include "bf_state.h"
+#include "bf_io.h"
+#include "bf_budget.h"
+
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+//! The interpreter as a library - compile a program once into a program_t, then run
+//  it as often as needed with an execution_t, which keeps its tape, I/O buffers and
+//  scratch space from one run to the next.
+//
+//      bf::program_t<> program(source, source_size);
+//      bf::execution_t<> execution;
+//      bf::buffer_source_t input(request, request_size);
+//      bf::buffer_sink_t output(reply, sizeof reply);
+//
+//      execution.run(program, input, output);
+//
+//  Errors, at compile time or while running, are thrown as error_t; a run given a
+//  budget_t that reaches one of its limits throws limit_reached_t.
+namespace bf {
+
+using detail::source_t;
+using detail::sink_t;
+using detail::fd_source_t;
+using detail::fd_sink_t;
+using detail::buffer_source_t;
+using detail::buffer_sink_t;
+using detail::callback_source_t;
+using detail::callback_sink_t;
+using detail::budget_t;
+using detail::callback_source;
+using detail::callback_sink;
+
+using detail::flush_t;
+using detail::FLUSH_Line;
+using detail::FLUSH_Block;
+using detail::FLUSH_Never;
+
+using detail::eof_t;
+using detail::EOF_Zero;
+using detail::EOF_MinusOne;
+using detail::EOF_Unchanged;
+
+using detail::wrap_policy_t;
+using detail::trap_policy_t;
+using detail::saturate_policy_t;
+
+//! What went wrong and the index in the source of every command that caused it, in
+//  source order - what display_error_cause takes.
+struct error_t : std::runtime_error {
+        error_t(const char* message, const std::vector<unsigned int>& commands) : std::runtime_error(message), commands(commands) {
+        }
+
+        ~error_t() throw() {
+        }
+
+        std::vector<unsigned int> commands;
+};
+
+//! A run stopped at the ']' that had no step left in its budget, or past its time.
+//  The execution's state is where it stopped. The back-edges the program's prefix
+//  took ahead of time are charged first; when they are more than the budget has,
+//  the run stops where the prefix left off, its output written.
+struct limit_reached_t : error_t {
+        limit_reached_t(const char* message, const std::vector<unsigned int>& commands) : error_t(message, commands) {
+        }
+};
+
+//! A compiled program - optimized bytecode and the state its input independent start
+//  leaves behind. Nothing changes it once it is built, so executions on different
+//  threads can share it. C is the cell type, P the overflow policy.
+template<typename C = unsigned char, typename P = wrap_policy_t> struct program_t {
+        program_t(const char* source, std::size_t source_size, bool ignore_unknowns = false);
+
+        //! Takes over what an earlier compilation produced, see cache_t.
+        program_t(detail::bytecode_t&& bytecode, detail::prefix_t<C>&& prefix) : bytecode_(std::move(bytecode)), prefix_(std::move(prefix)) {
+        }
+
+        const detail::bytecode_t&  bytecode() const { return bytecode_; }
+        const detail::prefix_t<C>& prefix() const { return prefix_; }
+
+private:
+        detail::bytecode_t bytecode_;
+        detail::prefix_t<C> prefix_;
+};
+
+template<typename C, typename P> program_t<C, P>::program_t(const char* source, std::size_t source_size, bool ignore_unknowns)
+{
+        try {
+                detail::compile(source, source_size, ignore_unknowns, bytecode_, P::wraps);
+        }
+        catch (detail::syntax_error& e) {
+                throw error_t(e.what(), e.commands);
+        }
+
+        detail::fold_prefix<C, P>(bytecode_, prefix_);
+}
+
+//! Runs programs with the threaded engine, one at a time. Each run starts on a zeroed
+//  tape; after the first one nothing is allocated unless the tape has to grow past
+//  what an earlier run left it at, or a loop is compiled. S is the cell storage.
+//  When tiered, loops that run often are compiled to native code, see
+//  evaluate_tiered.
+template<typename C = unsigned char, typename S = std::vector<C>, typename P = wrap_policy_t> struct execution_t {
+        explicit execution_t(flush_t flush = FLUSH_Block, eof_t eof = EOF_MinusOne, bool tiered = true);
+
+        //! Output written before an error is in output by the time error_t is thrown.
+        void run(const program_t<C, P>& program, source_t& input, sink_t& output);
+        void run(const program_t<C, P>& program, int input = STDIN_FILENO, int output = STDOUT_FILENO);
+
+        //! As run, spending every back-edge from budget.
+        void run(const program_t<C, P>& program, source_t& input, sink_t& output, budget_t& budget);
+        void run(const program_t<C, P>& program, int input, int output, budget_t& budget);
+
+        //! The tape as the last run left it.
+        const detail::state_t<unsigned int, S, P>& state() const { return state_; }
+
+private:
+        execution_t(const execution_t&);
+        execution_t& operator =(const execution_t&);
+
+        template<typename B> void start(const program_t<C, P>& program, B& budget);
+
+        detail::state_t<unsigned int, S, P> state_;
+        detail::io_t io_;
+        std::vector<detail::threaded_t> code_;
+        detail::no_recorder_t recorder_;
+        typename detail::tier_of<C, S, P>::type tier_;
+        flush_t flush_;
+        bool tiered_;
+        bool used_;                          // the tape needs zeroing before the next run
+};
+
+template<typename C, typename S, typename P> execution_t<C, S, P>::execution_t(flush_t flush, eof_t eof, bool tiered)
+        : io_(STDIN_FILENO, STDOUT_FILENO, flush, eof), flush_(flush), tiered_(tiered), used_(false)
+{
+}
+
+template<typename C, typename S, typename P> void execution_t<C, S, P>::run(const program_t<C, P>& program, source_t& input, sink_t& output)
+{
+        detail::no_budget_t budget;
+
+        io_.attach(input, output, flush_);
+        start(program, budget);
+}
+
+template<typename C, typename S, typename P> void execution_t<C, S, P>::run(const program_t<C, P>& program, int input, int output)
+{
+        detail::no_budget_t budget;
+
+        io_.attach(input, output, flush_);
+        start(program, budget);
+}
+
+template<typename C, typename S, typename P>
+void execution_t<C, S, P>::run(const program_t<C, P>& program, source_t& input, sink_t& output, budget_t& budget)
+{
+        io_.attach(input, output, flush_);
+        start(program, budget);
+}
+
+template<typename C, typename S, typename P>
+void execution_t<C, S, P>::run(const program_t<C, P>& program, int input, int output, budget_t& budget)
+{
+        io_.attach(input, output, flush_);
+        start(program, budget);
+}
+
+template<typename C, typename S, typename P> template<typename B> void execution_t<C, S, P>::start(const program_t<C, P>& program, B& budget)
+{
+        std::size_t at = 0;
+
+        if (used_)
+                state_.reset();
+
+        used_ = true;
+
+        try {
+                if (detail::tape_reach<S>::value != detail::unlimited_reach)
+                        detail::check_reach(program.bytecode(), detail::tape_reach<S>::value);
+
+                if (tiered_) {
+                        detail::run_threaded<C>(program.bytecode(), program.prefix(), state_, io_, recorder_, tier_, budget, code_, at);
+                }
+                else {
+                        detail::no_tier_t tier;
+
+                        detail::run_threaded<C>(program.bytecode(), program.prefix(), state_, io_, recorder_, tier, budget, code_, at);
+                }
+        }
+        catch (detail::syntax_error& e) {
+                throw error_t(e.what(), e.commands);
+        }
+        catch (detail::budget_exceeded_t& e) {
+                throw limit_reached_t(e.what(), std::vector<unsigned int>(1, program.bytecode().positions[at]));
+        }
+        catch (std::runtime_error& e) {
+                throw error_t(e.what(), std::vector<unsigned int>(1, program.bytecode().positions[at]));
+        }
+}
+
+} // namespace bf
+
+#endif /* _H_BF_PROGRAM */
\ No newline at end of file
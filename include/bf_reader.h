@@ -19,42 +19,107 @@
 #ifndef _H_BF_READER
 #define _H_BF_READER
 
-#include <string>
-#include <sstream>
-#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <vector>
+#include <cstring>
 #include <stdexcept>
 
 namespace detail {
 
+//! The program source, read without copying where possible. Regular files are
+//  mapped, anything else (pipes, terminals, "-" for stdin) is read in bulk. The
+//  front end gets a view of the bytes as they are - newlines, comments and all.
 struct reader_t {
         explicit reader_t(const char* filename);
+        ~reader_t();
 
         const char* raw();
         size_t size() const;
 
 private:
-        std::string raw_;
+        reader_t(const reader_t&);
+        reader_t& operator =(const reader_t&);
+
+        void read_all(int fd, size_t size_hint);
+
+        void* mapping_;
+        std::vector<char> buffer_;
         size_t length_;
 };
 
-reader_t::reader_t(const char* filename) : length_(0)
+inline reader_t::reader_t(const char* filename) : mapping_(0), length_(0)
 {
-        std::ifstream file(filename, std::fstream::in);
+        bool from_stdin = !std::strcmp(filename, "-");
+        int fd = from_stdin ? STDIN_FILENO : open(filename, O_RDONLY);
+        struct stat status;
 
-        if (!file)
+        if (fd < 0 || fstat(fd, &status) != 0)
                 throw std::runtime_error("Couldn't read file.");
 
-        std::string line;
+        if (S_ISREG(status.st_mode) && status.st_size > 0) {
+                void* mapping = mmap(0, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (mapping != MAP_FAILED) {
+                        madvise(mapping, status.st_size, MADV_SEQUENTIAL);
+                        mapping_ = mapping;
+                        length_ = status.st_size;
+                }
+        }
+
+        try {
+                if (!mapping_)
+                        read_all(fd, S_ISREG(status.st_mode) ? status.st_size : 0);
+        }
+        catch (std::runtime_error&) {
+                if (!from_stdin)
+                        close(fd);
+                throw;
+        }
+
+        //! The mapping stays valid once the file is closed.
+        if (!from_stdin)
+                close(fd);
+}
+
+inline reader_t::~reader_t()
+{
+        if (mapping_)
+                munmap(mapping_, length_);
+}
+
+//! Reads until the end of the file, doubling the buffer as needed.
+inline void reader_t::read_all(int fd, size_t size_hint)
+{
+        buffer_.resize(size_hint + 65536);
 
-        while (std::getline(file, line)) {
-                raw_.insert(raw_.end(), line.begin(), line.end());
-                length_ += line.size();
+        for (;;) {
+                ssize_t result = read(fd, &buffer_[length_], buffer_.size() - length_);
+
+                if (result < 0 && errno == EINTR)
+                        continue;
+                if (result < 0)
+                        throw std::runtime_error("Couldn't read file.");
+                if (result == 0)
+                        break;
+
+                length_ += result;
+
+                if (length_ == buffer_.size())
+                        buffer_.resize(buffer_.size() * 2);
         }
 }
 
 inline const char* reader_t::raw()
 {
-        return raw_.c_str();
+        if (mapping_)
+                return static_cast<const char*>(mapping_);
+
+        return length_ ? &buffer_[0] : "";
 }
 
 inline size_t reader_t::size() const
@@ -0,0 +1,202 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_SCAN
+#define _H_BF_SCAN
+
+#include <cstddef>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#  define BF_HAVE_SIMD_SCAN 1
+#  include <immintrin.h>
+#endif
+
+namespace detail {
+
+//! Finds the first zero cell at position, position + stride, ... Cells at or past
+//  size are zero, so the result may lie beyond the tape.
+template<typename C>
+std::ptrdiff_t scan_forward_scalar(const C* cells, std::ptrdiff_t size, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        while (position < size && cells[position] != 0)
+                position += stride;
+
+        return position;
+}
+
+//! Finds the last zero cell at position, position - stride, ... or returns -1.
+template<typename C>
+std::ptrdiff_t scan_backward_scalar(const C* cells, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        while (position >= 0 && cells[position] != 0)
+                position -= stride;
+
+        return position < 0 ? -1 : position;
+}
+
+#if defined(BF_HAVE_SIMD_SCAN)
+
+//! Reduces a byte compare mask to one bit per zero cell, at the cell's first byte.
+template<typename C> inline unsigned int zero_cells(unsigned int mask)
+{
+        if (sizeof(C) >= 2)
+                mask &= mask >> 1;
+        if (sizeof(C) >= 4)
+                mask &= mask >> 2;
+        if (sizeof(C) >= 8)
+                mask &= mask >> 4;
+
+        return mask;
+}
+
+//! Bits of the cells a scan visits in a block of the given width, counting from the
+//  first cell (forward) or from the last one (backward).
+template<typename C> inline unsigned int visited_cells(unsigned int width, std::ptrdiff_t stride, bool backward)
+{
+        std::ptrdiff_t lanes = width / sizeof(C);
+        unsigned int mask = 0;
+
+        for (std::ptrdiff_t lane = 0; lane != lanes; ++lane)
+                if ((backward ? lanes - 1 - lane : lane) % stride == 0)
+                        mask |= 1u << (lane * sizeof(C));
+
+        return mask;
+}
+
+template<typename C>
+std::ptrdiff_t scan_forward_sse2(const C* cells, std::ptrdiff_t size, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        const std::ptrdiff_t lanes = 16 / sizeof(C);
+        const unsigned int visited = visited_cells<C>(16, stride, false);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; position + lanes <= size; position += lanes) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells + position));
+                unsigned int found = zero_cells<C>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, zero))) & visited;
+
+                if (found)
+                        return position + __builtin_ctz(found) / sizeof(C);
+        }
+
+        return scan_forward_scalar(cells, size, position, stride);
+}
+
+template<typename C>
+std::ptrdiff_t scan_backward_sse2(const C* cells, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        const std::ptrdiff_t lanes = 16 / sizeof(C);
+        const unsigned int visited = visited_cells<C>(16, stride, true);
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; position - lanes + 1 >= 0; position -= lanes) {
+                std::ptrdiff_t start = position - lanes + 1;
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cells + start));
+                unsigned int found = zero_cells<C>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, zero))) & visited;
+
+                if (found)
+                        return start + (31 - __builtin_clz(found)) / sizeof(C);
+        }
+
+        return scan_backward_scalar(cells, position, stride);
+}
+
+template<typename C> __attribute__((target("avx2")))
+std::ptrdiff_t scan_forward_avx2(const C* cells, std::ptrdiff_t size, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        const std::ptrdiff_t lanes = 32 / sizeof(C);
+        const unsigned int visited = visited_cells<C>(32, stride, false);
+        const __m256i zero = _mm256_setzero_si256();
+
+        for (; position + lanes <= size; position += lanes) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cells + position));
+                unsigned int found = zero_cells<C>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, zero))) & visited;
+
+                if (found)
+                        return position + __builtin_ctz(found) / sizeof(C);
+        }
+
+        return scan_forward_scalar(cells, size, position, stride);
+}
+
+template<typename C> __attribute__((target("avx2")))
+std::ptrdiff_t scan_backward_avx2(const C* cells, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        const std::ptrdiff_t lanes = 32 / sizeof(C);
+        const unsigned int visited = visited_cells<C>(32, stride, true);
+        const __m256i zero = _mm256_setzero_si256();
+
+        for (; position - lanes + 1 >= 0; position -= lanes) {
+                std::ptrdiff_t start = position - lanes + 1;
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cells + start));
+                unsigned int found = zero_cells<C>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, zero))) & visited;
+
+                if (found)
+                        return start + (31 - __builtin_clz(found)) / sizeof(C);
+        }
+
+        return scan_backward_scalar(cells, position, stride);
+}
+
+inline bool have_avx2()
+{
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        return avx2;
+}
+
+//! The vector kernels handle strides that evenly divide a 16 byte block of cells.
+template<typename C> inline bool vector_stride(std::ptrdiff_t stride)
+{
+        return stride <= static_cast<std::ptrdiff_t>(16 / sizeof(C)) && (16 / sizeof(C)) % stride == 0;
+}
+
+#endif
+
+//! Zero cell search for '[>]' style loops - cells[position] when it's already zero,
+//  otherwise the first zero stride cells apart.
+template<typename C>
+std::ptrdiff_t scan_forward(const C* cells, std::ptrdiff_t size, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        if (position >= size || cells[position] == 0)
+                return position;
+
+#if defined(BF_HAVE_SIMD_SCAN)
+        if (vector_stride<C>(stride))
+                return have_avx2() ? scan_forward_avx2(cells, size, position, stride) : scan_forward_sse2(cells, size, position, stride);
+#endif
+
+        return scan_forward_scalar(cells, size, position, stride);
+}
+
+//! As scan_forward, for '[<]' style loops. Returns -1 if the scan runs off the tape.
+template<typename C>
+std::ptrdiff_t scan_backward(const C* cells, std::ptrdiff_t size, std::ptrdiff_t position, std::ptrdiff_t stride)
+{
+        if (position >= size || cells[position] == 0)
+                return position;
+
+#if defined(BF_HAVE_SIMD_SCAN)
+        if (vector_stride<C>(stride))
+                return have_avx2() ? scan_backward_avx2(cells, position, stride) : scan_backward_sse2(cells, position, stride);
+#endif
+
+        return scan_backward_scalar(cells, position, stride);
+}
+
+} // namespace detail
+
+#endif /* _H_BF_SCAN */
\ No newline at end of file
@@ -20,85 +20,190 @@
 #define _H_BF_STATE
 
 #include "bf_cells.h"
+#include "bf_scan.h"
+#include "bf_policy.h"
+#include "bf_inline.h"
 
 #include <limits>
 #include <stdexcept>
 
 namespace detail {
 
+//! Where a scan stride cells at a time from position stops - see scan_forward and
+//  scan_backward. Storages that aren't in one piece overload this.
+template<typename S> std::ptrdiff_t scan_cells(const cells_t<S>& cells, std::ptrdiff_t position, int stride)
+{
+        if (stride > 0)
+                return scan_forward(cells.data(), cells.size(), position, stride);
+
+        return scan_backward(cells.data(), cells.size(), position, -stride);
+}
+
 //! Program state - responsible for incrementing and decrementing the pc and
-//  cell values.
+//  cell values. The cell width comes from the storage, what happens at its
+//  limits from the overflow policy.
 template<
         typename T = unsigned int                 // pc
       , typename S = std::vector<unsigned char>   // cell storage
+      , typename P = wrap_policy_t                // overflow policy
 >
 struct state_t {
-        state_t() : pc_(0) {
+        state_t() : pc_(tape_origin<S>::value()) {
         }
 
-        void increment_current_cell(typename S::value_type value = 1);
-        void decrement_current_cell(typename S::value_type value = 1);
+        void increment_current_cell(int value = 1);
+        void decrement_current_cell(int value = 1);
+
+        void add(int offset, int value);           // cell at pc + offset += value
+        void multiply_add(int offset, int factor); // cell at pc + offset += cell * factor
+        void clear(int offset = 0);                // what [-] leaves behind, at pc + offset
 
         void increment_pc(T value = 1);
         void decrement_pc(T value = 1);
 
+        void scan(int stride);                 // move stride cells at a time until the cell is zero
+
         typename S::value_type  get() const;
         typename S::value_type& set();         // this should probably be something like set(C value)
 
+        typename S::value_type  get(int offset) const;     // cell at pc + offset
+        typename S::value_type& set(int offset);
+
         std::size_t cell_count() const;
+        std::size_t extent() const { return written_extent(cells_); }   // see written_extent
+        T pc() const { return pc_; }
+
+        //! Direct access for native code, which moves the pc on its own and has the
+        //  tape grown up to index before it goes past the end.
+        typename S::value_type* data() { return cells_.data(); }
+        void reserve(std::size_t index) { cells_[index]; }
+        void set_pc(T pc) { pc_ = pc; }
+
+        typename S::value_type at(std::size_t index) const;   // cell at index, counting from the first one
+
+        //! Puts image in the cells from the origin on and the pc at pointer from it -
+        //  the state a program prefix that was run ahead of time left behind.
+        void load(const std::vector<typename S::value_type>& image, T pointer);
+
+        void reset();                          // a zeroed tape again, for the next program
 
 private:
         cells_t<S> cells_;
         T pc_;
 };
 
-template<typename T, typename S> inline void state_t<T, S>::increment_current_cell(typename S::value_type value)
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::increment_current_cell(int value)
 {
-        if (cells_[pc_] == std::numeric_limits<typename S::value_type>::max())
-                throw std::runtime_error("cell overflow");
+        P::add(cells_[pc_], value);
+}
 
-        cells_[pc_] += value;
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::decrement_current_cell(int value)
+{
+        P::add(cells_[pc_], -value);
 }
 
-template<typename T, typename S> inline void state_t<T, S>::decrement_current_cell(typename S::value_type value)
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::add(int offset, int value)
 {
-        if (cells_[pc_] == std::numeric_limits<typename S::value_type>::min())
-                throw std::runtime_error("cell underflow");
+        P::add(set(offset), value);
+}
+
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::multiply_add(int offset, int factor)
+{
+        //! The loop this came from wouldn't have run on a zero cell.
+        if (typename S::value_type induction = cells_[pc_])
+                P::multiply_add(set(offset), induction, factor);
+}
+
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::clear(int offset)
+{
+        typename S::value_type& cell = set(offset);
 
-        cells_[pc_] -= value;
+        P::count_down(cell);
+
+        cell = 0;
 }
 
-template<typename T, typename S> inline void state_t<T, S>::increment_pc(T value)
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::increment_pc(T value)
 {
-        if (pc_ == std::numeric_limits<T>::max())
+        if (value > std::numeric_limits<T>::max() - pc_)
                 throw std::runtime_error("pc overflow");
 
         pc_ += value;
 }
 
-template<typename T, typename S> inline void state_t<T, S>::decrement_pc(T value)
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE void state_t<T, S, P>::decrement_pc(T value)
 {
-        if (pc_ == std::numeric_limits<T>::min())
+        if (value > pc_ - std::numeric_limits<T>::min())
                 throw std::runtime_error("pc underflow");
 
         pc_ -= value;
 }
 
-template<typename T, typename S> inline typename S::value_type state_t<T, S>::get() const
+template<typename T, typename S, typename P> inline void state_t<T, S, P>::scan(int stride)
+{
+        std::ptrdiff_t position = scan_cells(cells_, pc_, stride);
+
+        if (position > std::numeric_limits<T>::max())
+                throw std::runtime_error("pc overflow");
+
+        if (position < 0)
+                throw std::runtime_error("pc underflow");
+
+        pc_ = static_cast<T>(position);
+}
+
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE typename S::value_type state_t<T, S, P>::get() const
 {
         return cells_[pc_];
 }
 
-template<typename T, typename S> inline typename S::value_type& state_t<T, S>::set()
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE typename S::value_type& state_t<T, S, P>::set()
 {
         return cells_[pc_];
 }
 
-template<typename T, typename S> inline std::size_t state_t<T, S>::cell_count() const
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE typename S::value_type state_t<T, S, P>::get(int offset) const
+{
+        if (offset < 0 && static_cast<T>(-offset) > pc_)
+                throw std::runtime_error("pc underflow");
+
+        return cells_[pc_ + offset];
+}
+
+template<typename T, typename S, typename P> BF_ALWAYS_INLINE typename S::value_type& state_t<T, S, P>::set(int offset)
+{
+        if (offset < 0 && static_cast<T>(-offset) > pc_)
+                throw std::runtime_error("pc underflow");
+
+        return cells_[pc_ + offset];
+}
+
+template<typename T, typename S, typename P> inline std::size_t state_t<T, S, P>::cell_count() const
 {
         return cells_.size();
 }
 
+template<typename T, typename S, typename P> inline typename S::value_type state_t<T, S, P>::at(std::size_t index) const
+{
+        return cells_[index];
+}
+
+template<typename T, typename S, typename P> inline void state_t<T, S, P>::reset()
+{
+        cells_.reset();
+        pc_ = tape_origin<S>::value();
+}
+
+template<typename T, typename S, typename P> inline void state_t<T, S, P>::load(const std::vector<typename S::value_type>& image, T pointer)
+{
+        T origin = tape_origin<S>::value();
+
+        for (std::size_t i = 0; i != image.size(); ++i)
+                cells_[origin + i] = image[i];
+
+        pc_ = origin + pointer;
+}
+
 } // namespace detail
 
 #endif /* _H_BF_STATE */
@@ -0,0 +1,379 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_STATIC
+#define _H_BF_STATIC
+
+#include "bf_program.h"
+#include "bf_bytecode.h"
+#include "bf_state.h"
+#include "bf_policy.h"
+#include "bf_io.h"
+
+#include <unistd.h>
+
+#include <stdexcept>
+#include <utility>
+#include <array>
+#include <vector>
+#include <cstddef>
+
+namespace detail {
+
+const std::size_t static_none = static_cast<std::size_t>(-1);
+const std::size_t static_fuse_limit = 64;     // distinct cells a loop may add to and still be fused
+
+//! Bytecode built at compile time, for a source of N characters - which never needs
+//  more than N instructions and a Halt. Mistakes are kept rather than thrown, a
+//  static_assert reports them.
+template<std::size_t N> struct static_bytecode_t {
+        instruction_t code[N + 1];
+        unsigned int positions[N + 1];
+        std::size_t size;
+        std::size_t unmatched;                // source index of the first unmatched bracket
+        std::size_t invalid;                  // of the first invalid command
+};
+
+constexpr std::size_t static_length(const char* source)
+{
+        std::size_t length = 0;
+
+        while (source[length] != 0)
+                ++length;
+
+        return length;
+}
+
+template<std::size_t N>
+constexpr void static_emit(static_bytecode_t<N>& bytecode, int opcode, int operand, int offset, unsigned int position)
+{
+        bytecode.code[bytecode.size] = instruction_t{ opcode, operand, offset };
+        bytecode.positions[bytecode.size] = position;
+        ++bytecode.size;
+}
+
+//! As fuse_loop - a loop that only moves becomes a scan, one that adds, moves back
+//  to where it started and counts its cell down by one becomes multiply-adds and a
+//  clear. Unless cells wrap, only if it adds to each cell in one direction.
+template<std::size_t N> constexpr bool static_fuse_loop(static_bytecode_t<N>& bytecode, std::size_t open, bool wraps)
+{
+        std::size_t body = open + 1;
+        unsigned int position = bytecode.positions[open];
+
+        if (bytecode.size - body == 1 && bytecode.code[body].opcode == OP_Move) {
+                int stride = bytecode.code[body].operand;
+
+                bytecode.size = open;
+                static_emit(bytecode, OP_Scan, stride, 0, position);
+                return true;
+        }
+
+        int offsets[static_fuse_limit] = {};
+        int deltas[static_fuse_limit] = {};
+        std::size_t cells = 0;
+        int pointer = 0;
+
+        for (std::size_t i = body; i != bytecode.size; ++i) {
+                const instruction_t& instruction = bytecode.code[i];
+
+                if (instruction.opcode == OP_Move) {
+                        pointer += instruction.operand;
+                        continue;
+                }
+
+                if (instruction.opcode != OP_Add)
+                        return false;
+
+                std::size_t cell = 0;
+
+                while (cell != cells && offsets[cell] != pointer)
+                        ++cell;
+
+                if (cell == cells) {
+                        if (cells == static_fuse_limit)
+                                return false;
+
+                        offsets[cells++] = pointer;
+                }
+
+                if (!wraps && deltas[cell] != 0 && (deltas[cell] < 0) != (instruction.operand < 0))
+                        return false;
+
+                deltas[cell] += instruction.operand;
+        }
+
+        int counted = 0;
+
+        for (std::size_t cell = 0; cell != cells; ++cell)
+                if (offsets[cell] == 0)
+                        counted = deltas[cell];
+
+        if (pointer != 0 || counted != -1)
+                return false;
+
+        bytecode.size = open;
+
+        for (std::size_t cell = 0; cell != cells; ++cell)
+                if (offsets[cell] != 0 && deltas[cell] != 0)
+                        static_emit(bytecode, OP_MulAdd, deltas[cell], offsets[cell], position);
+
+        static_emit(bytecode, OP_Clear, 0, 0, position);
+        return true;
+}
+
+//! compile, in a constant expression - runs folded, loops fused, brackets paired up.
+template<std::size_t N> constexpr static_bytecode_t<N> compile_static(const char* program, bool ignore_unknowns, bool wraps)
+{
+        static_bytecode_t<N> bytecode{};
+        std::size_t opens[N + 1] = {};
+        std::size_t open_count = 0;
+        unsigned int command_index = 0;
+
+        bytecode.unmatched = bytecode.invalid = static_none;
+
+        while (command_index != N) {
+                unsigned int position = command_index;
+                int value = 0;
+
+                switch (program[command_index]) {
+                case '+':
+                case '-':
+                        if ((value = run_value(program, N, command_index, '+', '-', ignore_unknowns, wraps)) != 0)
+                                static_emit(bytecode, OP_Add, value, 0, position);
+                        continue;
+                case '>':
+                case '<':
+                        if ((value = run_value(program, N, command_index, '>', '<', ignore_unknowns)) != 0)
+                                static_emit(bytecode, OP_Move, value, 0, position);
+                        continue;
+                case '.':
+                        static_emit(bytecode, OP_Output, run_length(program, N, command_index, ignore_unknowns), 0, position);
+                        continue;
+                case ',':
+                        static_emit(bytecode, OP_Input, 0, 0, position);
+                        break;
+                case '[':
+                        opens[open_count++] = bytecode.size;
+                        static_emit(bytecode, OP_Open, 0, 0, position);
+                        break;
+                case ']':
+                        if (open_count == 0) {
+                                if (bytecode.unmatched == static_none)
+                                        bytecode.unmatched = command_index;
+                                break;
+                        }
+
+                        {
+                                std::size_t open = opens[--open_count];
+
+                                if (static_fuse_loop(bytecode, open, wraps))
+                                        break;
+
+                                bytecode.code[open].operand = static_cast<int>(bytecode.size);
+                                static_emit(bytecode, OP_Close, static_cast<int>(open), 0, position);
+                        }
+                        break;
+                default:
+                        if (!is_skippable(program[command_index], ignore_unknowns) && bytecode.invalid == static_none)
+                                bytecode.invalid = command_index;
+                }
+
+                ++command_index;
+        }
+
+        if (open_count != 0 && bytecode.unmatched == static_none)
+                bytecode.unmatched = bytecode.positions[opens[0]];
+
+        static_emit(bytecode, OP_Halt, 0, 0, command_index);
+
+        return bytecode;
+}
+
+//! Instructions of [begin, end) outside of the loops in it - what a block runs one
+//  after the other.
+template<std::size_t N> constexpr std::size_t static_step_count(const static_bytecode_t<N>& bytecode, std::size_t begin, std::size_t end)
+{
+        std::size_t count = 0;
+
+        for (std::size_t i = begin; i < end; ++count)
+                i = bytecode.code[i].opcode == OP_Open ? bytecode.code[i].operand + 1 : i + 1;
+
+        return count;
+}
+
+template<std::size_t Count, std::size_t N> constexpr std::array<std::size_t, Count> static_steps(const static_bytecode_t<N>& bytecode, std::size_t begin)
+{
+        std::array<std::size_t, Count> steps{};
+        std::size_t i = begin;
+
+        for (std::size_t step = 0; step != Count; ++step) {
+                steps[step] = i;
+                i = bytecode.code[i].opcode == OP_Open ? bytecode.code[i].operand + 1 : i + 1;
+        }
+
+        return steps;
+}
+
+//! What a program built at compile time runs on.
+template<typename C, typename P> struct static_machine_t {
+        static_machine_t(flush_t flush, eof_t eof) : io(STDIN_FILENO, STDOUT_FILENO, flush, eof) {
+        }
+
+        state_t<unsigned int, std::vector<C>, P> state;
+        io_t io;
+};
+
+template<typename B, std::size_t Begin, std::size_t End> struct static_block_t;
+
+//! The instruction at I of B::bytecode as code of its own - a loop runs its body
+//  block for as long as its cell isn't zero. Errors are thrown as error_t, with
+//  where the instruction came from.
+template<typename B, std::size_t I> struct static_step_t {
+        static constexpr instruction_t instruction = B::bytecode.code[I];
+
+        template<typename M> static void run(M& machine) {
+                if constexpr (instruction.opcode == OP_Open) {
+                        while (machine.state.get() != 0)
+                                static_block_t<B, I + 1, static_cast<std::size_t>(instruction.operand)>::run(machine);
+                }
+                else {
+                        try {
+                                execute(machine);
+                        }
+                        catch (std::runtime_error& e) {
+                                throw bf::error_t(e.what(), std::vector<unsigned int>(1, B::bytecode.positions[I]));
+                        }
+                }
+        }
+
+        template<typename M> BF_ALWAYS_INLINE static void execute(M& machine) {
+                if constexpr (instruction.opcode == OP_Add)
+                        machine.state.add(instruction.offset, instruction.operand);
+                else if constexpr (instruction.opcode == OP_Move && instruction.operand > 0)
+                        machine.state.increment_pc(instruction.operand);
+                else if constexpr (instruction.opcode == OP_Move)
+                        machine.state.decrement_pc(-instruction.operand);
+                else if constexpr (instruction.opcode == OP_Output)
+                        machine.io.put(machine.state.get(instruction.offset), instruction.operand);
+                else if constexpr (instruction.opcode == OP_Input)
+                        machine.io.get(machine.state.set(instruction.offset));
+                else if constexpr (instruction.opcode == OP_Clear)
+                        machine.state.clear(instruction.offset);
+                else if constexpr (instruction.opcode == OP_MulAdd)
+                        machine.state.multiply_add(instruction.offset, instruction.operand);
+                else if constexpr (instruction.opcode == OP_Scan)
+                        machine.state.scan(instruction.operand);
+                else
+                        machine.io.flush();
+        }
+};
+
+//! Runs the instructions of [Begin, End) that are outside of its loops, in order.
+template<typename B, std::size_t Begin, std::size_t End> struct static_block_t {
+        static constexpr std::size_t count = static_step_count(B::bytecode, Begin, End);
+        static constexpr std::array<std::size_t, count> steps = static_steps<count>(B::bytecode, Begin);
+
+        template<typename M> BF_ALWAYS_INLINE static void run(M& machine) {
+                run(machine, std::make_index_sequence<count>());
+        }
+
+        template<typename M, std::size_t... K> BF_ALWAYS_INLINE static void run(M& machine, std::index_sequence<K...>) {
+                (static_step_t<B, steps[K]>::run(machine), ...);
+        }
+};
+
+} // namespace detail
+
+//! A program built into the binary - parsed and optimized by the compiler, every
+//  instruction turned into code of its own, so there is nothing left to do when it
+//  starts. Source has to be a constexpr array with static storage, an unmatched
+//  bracket or an invalid command is a compile time error.
+//
+//      constexpr char rot13[] = "-,+[-[>>++++[>++++++++<-]<+<-[...";
+//
+//      bf::static_program_t<rot13> program(bf::FLUSH_Block, bf::EOF_MinusOne);
+//
+//      program.run(input, output);
+//
+//  It keeps its tape and I/O buffers from one run to the next, like an execution_t,
+//  so it too is for one thread at a time. Errors while running are thrown as error_t.
+namespace bf {
+
+template<const char* Source, typename C = unsigned char, typename P = wrap_policy_t, bool IgnoreUnknowns = false>
+struct static_program_t {
+        static constexpr std::size_t source_size = detail::static_length(Source);
+        static constexpr detail::static_bytecode_t<source_size> bytecode = detail::compile_static<source_size>(Source, IgnoreUnknowns, P::wraps);
+
+        static_assert(bytecode.unmatched == detail::static_none, "can't find corresponding command - the program has an unmatched '[' or ']'");
+        static_assert(bytecode.invalid == detail::static_none, "found an invalid command in the program");
+
+        explicit static_program_t(flush_t flush = FLUSH_Block, eof_t eof = EOF_MinusOne) : machine_(flush, eof), flush_(flush), used_(false) {
+        }
+
+        void run(source_t& input, sink_t& output);
+        void run(int input = STDIN_FILENO, int output = STDOUT_FILENO);
+
+        //! The tape as the last run left it.
+        const detail::state_t<unsigned int, std::vector<C>, P>& state() const { return machine_.state; }
+
+private:
+        static_program_t(const static_program_t&);
+        static_program_t& operator =(const static_program_t&);
+
+        void start();
+
+        detail::static_machine_t<C, P> machine_;
+        flush_t flush_;
+        bool used_;
+};
+
+template<const char* Source, typename C, typename P, bool IgnoreUnknowns>
+void static_program_t<Source, C, P, IgnoreUnknowns>::run(source_t& input, sink_t& output)
+{
+        machine_.io.attach(input, output, flush_);
+        start();
+}
+
+template<const char* Source, typename C, typename P, bool IgnoreUnknowns>
+void static_program_t<Source, C, P, IgnoreUnknowns>::run(int input, int output)
+{
+        machine_.io.attach(input, output, flush_);
+        start();
+}
+
+template<const char* Source, typename C, typename P, bool IgnoreUnknowns>
+void static_program_t<Source, C, P, IgnoreUnknowns>::start()
+{
+        if (used_)
+                machine_.state.reset();
+
+        used_ = true;
+
+        try {
+                detail::static_block_t<static_program_t, 0, bytecode.size>::run(machine_);
+        }
+        catch (error_t&) {
+                machine_.io.flush_quietly();
+                throw;
+        }
+}
+
+} // namespace bf
+
+#endif /* _H_BF_STATIC */
\ No newline at end of file
@@ -0,0 +1,233 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_STATS
+#define _H_BF_STATS
+
+#include "bf_profile.h"
+
+#if defined(__linux__)
+#  define BF_HAVE_PERF_EVENTS 1
+#  include <linux/perf_event.h>
+#  include <sys/syscall.h>
+#  include <sys/ioctl.h>
+#endif
+
+#include <unistd.h>
+#include <time.h>
+
+#include <ostream>
+#include <iomanip>
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+
+namespace detail {
+
+inline double monotonic_seconds()
+{
+        struct timespec now;
+
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+//! Hardware counters of this process around the execution phase, when the kernel
+//  lets us have them (perf_event_paranoid, containers and virtual machines may not).
+struct perf_counters_t {
+        enum {
+                COUNTER_Cycles
+              , COUNTER_Instructions
+              , COUNTER_BranchMisses
+              , COUNTER_Count
+        };
+
+        perf_counters_t();
+        ~perf_counters_t();
+
+        void start();
+        void stop();
+
+        bool available(int counter) const { return fds_[counter] >= 0; }
+        uint64_t value(int counter) const { return values_[counter]; }
+
+private:
+        perf_counters_t(const perf_counters_t&);
+        perf_counters_t& operator =(const perf_counters_t&);
+
+        int fds_[COUNTER_Count];
+        uint64_t values_[COUNTER_Count];
+};
+
+inline perf_counters_t::perf_counters_t()
+{
+        for (int i = 0; i != COUNTER_Count; ++i) {
+                fds_[i] = -1;
+                values_[i] = 0;
+        }
+}
+
+inline perf_counters_t::~perf_counters_t()
+{
+        for (int i = 0; i != COUNTER_Count; ++i)
+                if (fds_[i] >= 0)
+                        close(fds_[i]);
+}
+
+//! Opens the counters and starts counting, whatever can't be opened stays unavailable.
+inline void perf_counters_t::start()
+{
+#if defined(BF_HAVE_PERF_EVENTS)
+        static const uint64_t configs[COUNTER_Count] = {
+                PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES
+        };
+
+        for (int i = 0; i != COUNTER_Count; ++i) {
+                struct perf_event_attr attributes;
+
+                std::memset(&attributes, 0, sizeof attributes);
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.size = sizeof attributes;
+                attributes.config = configs[i];
+                attributes.disabled = 1;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+
+                if (fds_[i] < 0)
+                        fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        }
+
+        for (int i = 0; i != COUNTER_Count; ++i) {
+                if (fds_[i] >= 0) {
+                        ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+                        ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+                }
+        }
+#endif
+}
+
+inline void perf_counters_t::stop()
+{
+#if defined(BF_HAVE_PERF_EVENTS)
+        for (int i = 0; i != COUNTER_Count; ++i) {
+                if (fds_[i] >= 0) {
+                        ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+
+                        if (read(fds_[i], &values_[i], sizeof values_[i]) != sizeof values_[i]) {
+                                close(fds_[i]);
+                                fds_[i] = -1;
+                        }
+                }
+        }
+#endif
+}
+
+//! Recorder behind --stats. Times the phases of a run and counts what executes -
+//  totals only, so it costs a lot less than a profile.
+struct stats_t {
+        static const bool enabled = true;
+
+        stats_t() : instructions_(0), loop_iterations_(0), fused_iterations_(0), cells_(0), load_(0), compiled_(0), finished_(0) {
+                start_ = monotonic_seconds();
+        }
+
+        //! The source has been read, what comes next is the front end.
+        void loaded() { load_ = monotonic_seconds(); }
+
+        void executed(unsigned int)  { ++instructions_; }
+        void loop(unsigned int, loop_kind_t, uint64_t iterations) { fused_iterations_ += iterations; }
+        void entered(unsigned int)   {}
+        void iterated(unsigned int)  { ++loop_iterations_; }
+
+        void compiled() {
+                counters_.start();
+                compiled_ = monotonic_seconds();
+        }
+
+        void finished(std::size_t cells) {
+                counters_.stop();
+                finished_ = monotonic_seconds();
+                cells_ = cells;
+        }
+
+        //! Counts are only there for engines that report instructions.
+        void report(std::ostream& out, bool counted) const;
+
+private:
+        uint64_t instructions_;
+        uint64_t loop_iterations_;
+        uint64_t fused_iterations_;
+        std::size_t cells_;
+
+        double start_;
+        double load_;
+        double compiled_;
+        double finished_;
+
+        perf_counters_t counters_;
+};
+
+inline void stats_t::report(std::ostream& out, bool counted) const
+{
+        double loaded = load_ ? load_ : start_;
+        double execution = finished_ - compiled_;
+
+        out<<"Stats:"<<std::endl
+           <<std::fixed<<std::setprecision(6)
+           <<"  load                "<<std::setw(12)<<loaded - start_<<" s"<<std::endl;
+
+        //! The front end rejected the program.
+        if (!compiled_)
+                return;
+
+        out<<"  compile             "<<std::setw(12)<<compiled_ - loaded<<" s"<<std::endl
+           <<"  execute             "<<std::setw(12)<<execution<<" s"<<std::endl;
+
+        if (counted) {
+                out<<"  instructions        "<<std::setw(12)<<instructions_;
+                if (execution > 0)
+                        out<<" ("<<std::setprecision(1)<<instructions_ / execution / 1e6<<" M/s)";
+                out<<std::endl
+                   <<"  loop iterations     "<<std::setw(12)<<loop_iterations_<<std::endl
+                   <<"  fused iterations    "<<std::setw(12)<<fused_iterations_<<std::endl;
+        }
+        else
+                out<<"  instructions not counted in native code"<<std::endl;
+
+        out<<"  tape cells          "<<std::setw(12)<<cells_<<std::endl;
+
+        static const char* const names[perf_counters_t::COUNTER_Count] = {
+                "cycles", "instructions (cpu)", "branch misses"
+        };
+
+        bool any = false;
+
+        for (int i = 0; i != perf_counters_t::COUNTER_Count; ++i) {
+                if (counters_.available(i)) {
+                        out<<"  "<<std::left<<std::setw(20)<<names[i]<<std::right<<std::setw(12)<<counters_.value(i)<<std::endl;
+                        any = true;
+                }
+        }
+
+        if (!any)
+                out<<"  hardware counters unavailable"<<std::endl;
+}
+
+} // namespace detail
+
+#endif /* _H_BF_STATS */
\ No newline at end of file
@@ -0,0 +1,100 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_SYNTAX
+#define _H_BF_SYNTAX
+
+#include <stdexcept>
+#include <vector>
+#include <cstddef>
+
+namespace detail {
+
+//! Thrown by the front ends, carries the index of every offending command - the
+//  first of them in command_index.
+struct syntax_error : std::runtime_error {
+        syntax_error(const char* message, unsigned int command_index) : std::runtime_error(message), command_index(command_index), commands(1, command_index) {
+        }
+
+        syntax_error(const char* message, const std::vector<unsigned int>& commands) : std::runtime_error(message), command_index(commands.front()), commands(commands) {
+        }
+
+        ~syntax_error() throw() {
+        }
+
+        unsigned int command_index;
+        std::vector<unsigned int> commands;
+};
+
+//! Pairs up '[' and ']' in a single pass over the source. Each '[' is pushed with a
+//  slot of the caller's choosing (a table or instruction index) and popped by its
+//  ']'. Mismatches are collected instead of thrown so that finish() can report all
+//  of them at once.
+struct bracket_matcher_t {
+        void open(unsigned int command_index, std::size_t slot);
+        bool close(unsigned int command_index, std::size_t& slot);  // false for a stray ']'
+        void finish();
+
+private:
+        struct open_t {
+                unsigned int command_index;
+                std::size_t  slot;
+        };
+
+        std::vector<open_t> open_;
+        std::vector<unsigned int> stray_;
+};
+
+inline void bracket_matcher_t::open(unsigned int command_index, std::size_t slot)
+{
+        open_t open = { command_index, slot };
+
+        open_.push_back(open);
+}
+
+inline bool bracket_matcher_t::close(unsigned int command_index, std::size_t& slot)
+{
+        if (open_.empty()) {
+                stray_.push_back(command_index);
+                return false;
+        }
+
+        slot = open_.back().slot;
+        open_.pop_back();
+
+        return true;
+}
+
+//! Throws if anything is left unmatched. A stray ']' is only possible while no '['
+//  is open, so all of them come before the '[' still open - already in source order.
+inline void bracket_matcher_t::finish()
+{
+        if (open_.empty() && stray_.empty())
+                return;
+
+        std::vector<unsigned int> mismatches(stray_);
+
+        for (std::size_t i = 0; i != open_.size(); ++i)
+                mismatches.push_back(open_[i].command_index);
+
+        throw syntax_error("can't find corresponding command", mismatches);
+}
+
+} // namespace detail
+
+#endif /* _H_BF_SYNTAX */
\ No newline at end of file
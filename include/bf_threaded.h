@@ -0,0 +1,341 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _H_BF_THREADED
+#define _H_BF_THREADED
+
+#include "bf_evaluate.h"
+#include "bf_bytecode.h"
+#include "bf_state.h"
+#include "bf_profile.h"
+#include "bf_prefix.h"
+
+#include <type_traits>
+#include <stdexcept>
+#include <vector>
+#include <cstdlib>
+
+namespace detail {
+
+//! Threaded form of an instruction - the opcode is replaced by the address of
+//  its handler, four of these fit in a cache line.
+struct threaded_t {
+        const void* handler;
+        int         operand;
+        int         offset;
+};
+
+inline void thread(const bytecode_t& bytecode, const void* const* handlers, std::vector<threaded_t>& code)
+{
+        code.resize(bytecode.code.size());
+
+        for (std::size_t i = 0; i != code.size(); ++i) {
+                code[i].handler = handlers[bytecode.code[i].opcode];
+                code[i].operand = bytecode.code[i].operand;
+                code[i].offset  = bytecode.code[i].offset;
+        }
+}
+
+//! Leaves every loop to the interpreter. A tier compiles loops that run often to
+//  native code: hot is told of every back-edge and says when the loop should be
+//  promoted, promote compiles it - spending from a budget if budgeted - and run runs
+//  it to completion from the current cell. run returns why it failed, if it did, and
+//  where to carry on - just past the loop, or at the instruction that failed.
+struct no_tier_t {
+        static const bool enabled = false;
+
+        void reset(const bytecode_t&) {}
+        bool hot(std::size_t) { return false; }
+        int promote(const bytecode_t&, std::size_t, bool) { return 0; }
+
+        template<typename T, typename S, typename P, typename B> const char* run(int, state_t<T, S, P>&, io_t&, B&, std::size_t& next) {
+                next = 0;
+                return 0;
+        }
+};
+
+} // namespace detail
+
+#if defined(__GNUC__)
+
+namespace detail {
+
+//! Runs compiled bytecode with direct threading - every handler jumps straight to
+//  the handler of the next instruction - starting from where prefix left off.
+//  Each instruction also tells the recorder it ran, unless R is no_recorder_t, in
+//  which case the counting is compiled out. Loops the tier promotes run natively
+//  from then on, their '[' handing over to it. Every back-edge, native ones included,
+//  is spent from the budget, the prefix's first. code is scratch space, so it can be reused from one run
+//  to the next. Running starts at instruction at - 0 for the whole program, the '['
+//  of a checkpoint to resume it. Errors are thrown with at set to the index of the
+//  failing instruction, budget_exceeded_t at the ']' that had no step left - or at
+//  0 when the prefix already took more than the budget has.
+template<typename C, typename S, typename P, typename R, typename T, typename B>
+void run_threaded(const bytecode_t& bytecode, const prefix_t<C>& prefix, state_t<unsigned int, S, P>& state, io_t& io, R& recorder,
+                  T& tier, B& budget, std::vector<threaded_t>& code, std::size_t& at)
+{
+        typedef typename std::make_unsigned<typename S::value_type>::type count_t;
+
+        static const void* const handlers[OP_Count] = {
+                &&op_add, &&op_move, &&op_output, &&op_input, &&op_open, &&op_close, &&op_clear, &&op_muladd, &&op_scan, &&op_set, &&op_halt
+        };
+
+        thread(bytecode, handlers, code);
+
+        if (T::enabled)
+                tier.reset(bytecode);
+
+        budget.start();
+
+        watched_output_t<S> watched(io);
+        const threaded_t* ip = &code[at];
+
+        try {
+                restore_prefix(prefix, state, io);
+
+                if (!budget.spend(prefix.steps))
+                        throw budget_exceeded_t(budget.reached());
+
+                goto *ip->handler;
+
+        op_add:
+                if (R::enabled)
+                        recorder.executed(bytecode.positions[ip - &code[0]]);
+                state.add(ip->offset, ip->operand);
+                goto *(++ip)->handler;
+        op_move:
+                if (R::enabled)
+                        recorder.executed(bytecode.positions[ip - &code[0]]);
+                if (ip->operand > 0)
+                        state.increment_pc(ip->operand);
+                else
+                        state.decrement_pc(-ip->operand);
+                goto *(++ip)->handler;
+        op_output:
+                if (R::enabled)
+                        recorder.executed(bytecode.positions[ip - &code[0]]);
+                io.put(state.get(ip->offset), ip->operand);
+                goto *(++ip)->handler;
+        op_input:
+                if (R::enabled)
+                        recorder.executed(bytecode.positions[ip - &code[0]]);
+                io.get(state.set(ip->offset));
+                goto *(++ip)->handler;
+        op_open:
+                if (R::enabled) {
+                        unsigned int position = bytecode.positions[ip - &code[0]];
+
+                        recorder.executed(position);
+                        recorder.entered(position);
+                        if (state.get() != 0)
+                                recorder.iterated(position);
+                }
+                if (state.get() == 0)
+                        ip = &code[ip->operand];
+                goto *(++ip)->handler;
+        op_close:
+                if (R::enabled) {
+                        recorder.executed(bytecode.positions[ip - &code[0]]);
+                        if (state.get() != 0)
+                                recorder.iterated(bytecode.positions[ip->operand]);
+                }
+                if (state.get() != 0) {
+                        if (B::enabled && !budget.spend())
+                                throw budget_exceeded_t(budget.reached());
+
+                        ip = &code[ip->operand];
+
+                        if (T::enabled && tier.hot(ip - &code[0])) {
+                                threaded_t& open = code[ip - &code[0]];
+
+                                open.operand = tier.promote(bytecode, ip - &code[0], B::enabled);
+                                open.handler = &&op_native;
+                                goto op_native;
+                        }
+                }
+                goto *(++ip)->handler;
+        op_native:
+                {
+                        std::size_t next;
+                        const char* error = tier.run(ip->operand, state, io, budget, next);
+
+                        ip = &code[next];
+                        if (B::enabled && error && budget.reached())
+                                throw budget_exceeded_t(error);
+                        if (error)
+                                throw std::runtime_error(error);
+                }
+                goto *(++ip)->handler;
+        op_clear:
+                if (R::enabled) {
+                        unsigned int position = bytecode.positions[ip - &code[0]];
+                        bool multiply = ip != &code[0] && (ip - 1)->handler == &&op_muladd;
+
+                        recorder.executed(position);
+                        recorder.loop(position, multiply ? LOOP_MulAdd : LOOP_Clear, static_cast<count_t>(state.get(ip->offset)));
+                }
+                state.clear(ip->offset);
+                goto *(++ip)->handler;
+        op_muladd:
+                state.multiply_add(ip->offset, ip->operand);
+                goto *(++ip)->handler;
+        op_scan:
+                if (R::enabled) {
+                        unsigned int position = bytecode.positions[ip - &code[0]];
+                        std::ptrdiff_t from = state.pc();
+
+                        state.scan(ip->operand);
+                        recorder.executed(position);
+                        recorder.loop(position, LOOP_Scan, (state.pc() - from) / ip->operand);
+                        goto *(++ip)->handler;
+                }
+                state.scan(ip->operand);
+                goto *(++ip)->handler;
+        op_set:
+                if (R::enabled)
+                        recorder.executed(bytecode.positions[ip - &code[0]]);
+                state.set(ip->offset) = static_cast<typename S::value_type>(ip->operand);
+                goto *(++ip)->handler;
+        op_halt:
+                recorder.finished(state.cell_count());
+                io.flush();
+        }
+        catch (std::runtime_error&) {
+                at = ip - &code[0];
+                recorder.finished(state.cell_count());
+                io.flush_quietly();
+                throw;
+        }
+}
+
+template<typename C, typename S, typename P, typename R, typename T>
+void run_threaded(const bytecode_t& bytecode, const prefix_t<C>& prefix, state_t<unsigned int, S, P>& state, io_t& io, R& recorder,
+                  T& tier, std::vector<threaded_t>& code, std::size_t& at)
+{
+        no_budget_t budget;
+
+        run_threaded<C>(bytecode, prefix, state, io, recorder, tier, budget, code, at);
+}
+
+template<typename C, typename S, typename P, typename R>
+void run_threaded(const bytecode_t& bytecode, const prefix_t<C>& prefix, state_t<unsigned int, S, P>& state, io_t& io, R& recorder,
+                  std::vector<threaded_t>& code, std::size_t& at)
+{
+        no_tier_t tier;
+
+        run_threaded<C>(bytecode, prefix, state, io, recorder, tier, code, at);
+}
+
+} // namespace detail
+
+//! Compiles the program to bytecode and evaluates it with direct threading. Without
+//  a recorder or a budget, whatever the program does before it reads input is run
+//  ahead of time. Hot loops are handed to tier, back-edges spent from budget.
+template<typename C, typename S, typename P, typename R, typename T, typename B>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, T& tier, B& budget)
+{
+        detail::bytecode_t bytecode;
+
+        try {
+                detail::compile(program, program_size, ignore_unknowns, bytecode, P::wraps);
+                detail::check_reach(bytecode, detail::tape_reach<S>::value);
+        }
+        catch (detail::syntax_error& e) {
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        detail::prefix_t<C> prefix;
+
+        if (!R::enabled && !B::enabled)
+                detail::fold_prefix<C, P>(bytecode, prefix);
+
+        recorder.compiled();
+
+        detail::state_t<unsigned int, S, P> state;
+        std::vector<detail::threaded_t> code;
+        std::size_t at = 0;
+
+        try {
+                detail::run_threaded<C>(bytecode, prefix, state, io, recorder, tier, budget, code, at);
+        }
+        catch (detail::budget_exceeded_t&) {
+                return detail::display_limit_reached(budget, program, program_size, bytecode.positions[at], state);
+        }
+        catch (std::runtime_error& e) {
+                return detail::display_error_cause(e.what(), program, program_size, bytecode.positions[at]);
+        }
+
+        return EXIT_SUCCESS;
+}
+
+template<typename C, typename S, typename P, typename R, typename T>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, T& tier)
+{
+        detail::no_budget_t budget;
+
+        return evaluate_threaded<C, S, P>(program, program_size, ignore_unknowns, io, recorder, tier, budget);
+}
+
+template<typename C, typename S, typename P, typename R>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder)
+{
+        detail::no_tier_t tier;
+
+        return evaluate_threaded<C, S, P>(program, program_size, ignore_unknowns, io, recorder, tier);
+}
+
+#else
+
+//! Computed goto is unavailable, fall back to the switch interpreter.
+template<typename C, typename S, typename P, typename R>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder)
+{
+        return evaluate<C, S, P>(program, program_size, ignore_unknowns, io, recorder);
+}
+
+template<typename C, typename S, typename P, typename R, typename T>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, T&)
+{
+        return evaluate<C, S, P>(program, program_size, ignore_unknowns, io, recorder);
+}
+
+template<typename C, typename S, typename P, typename R, typename T, typename B>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, T&, B& budget)
+{
+        return evaluate<C, S, P>(program, program_size, ignore_unknowns, io, recorder, budget);
+}
+
+#endif
+
+template<typename C, typename S, typename P>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io)
+{
+        detail::no_recorder_t recorder;
+
+        return evaluate_threaded<C, S, P>(program, program_size, ignore_unknowns, io, recorder);
+}
+
+template<typename C>
+int evaluate_threaded(const char* program, size_t program_size, bool ignore_unknowns = false)
+{
+        detail::io_t io;
+
+        return evaluate_threaded<C, std::vector<C>, detail::wrap_policy_t>(program, program_size, ignore_unknowns, io);
+}
+
+#endif /* _H_BF_THREADED */
\ No newline at end of file
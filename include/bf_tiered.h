@@ -0,0 +1,214 @@
+//! A simple Brainfuck interpreter.
+/*!
+    Copyright (C) 2011  Konstantin Mandrika
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef _H_BF_TIERED
+#define _H_BF_TIERED
+
+#include "bf_threaded.h"
+#include "bf_jit.h"
+#include "bf_bytecode.h"
+#include "bf_state.h"
+#include "bf_policy.h"
+#include "bf_io.h"
+
+#include <type_traits>
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+namespace detail {
+
+//! The tier used with each overflow policy - native code only wraps.
+template<typename C, typename S, typename P> struct tier_of {
+        typedef no_tier_t type;
+};
+
+} // namespace detail
+
+#if defined(BF_HAVE_JIT)
+
+namespace detail {
+
+const unsigned int promotion_threshold = 1000;   // back-edges a loop takes before it is compiled
+
+//! The interpreter's own cells as seen by native code - both work on the same tape,
+//  so control can pass between them at any loop.
+template<typename C, typename S, typename P> struct jit_state_tape_t {
+        static const bool checked = true;
+
+        jit_state_tape_t(state_t<unsigned int, S, P>& state, int highest) : state_(state), highest_(highest) {
+        }
+
+        void bind(jit_context_t& context);
+
+        C* base()                { return state_.data(); }
+        std::ptrdiff_t size()    { return state_.cell_count(); }
+        C* reserve(jit_context_t& context, std::ptrdiff_t position);
+
+private:
+        state_t<unsigned int, S, P>& state_;
+        int highest_;
+};
+
+template<typename C, typename S, typename P> inline void jit_state_tape_t<C, S, P>::bind(jit_context_t& context)
+{
+        context.tape = this;
+        context.low  = base();
+        context.high = base() + size() - highest_;
+}
+
+template<typename C, typename S, typename P> inline C* jit_state_tape_t<C, S, P>::reserve(jit_context_t& context, std::ptrdiff_t position)
+{
+        state_.reserve(position + highest_);
+        bind(context);
+
+        return base() + position;
+}
+
+//! Counts back-edges per loop and compiles a loop to native code once it has taken
+//  promotion_threshold of them. Compiled loops last for the run.
+template<typename C, typename S> struct jit_tier_t {
+        static const bool enabled = true;
+
+        void reset(const bytecode_t& bytecode);
+        bool hot(std::size_t open) { return ++back_edges_[open] == promotion_threshold; }
+        int promote(const bytecode_t& bytecode, std::size_t open, bool budgeted);
+
+        template<typename P, typename B> const char* run(int loop, state_t<unsigned int, S, P>& state, io_t& io, B& budget, std::size_t& next);
+
+private:
+        struct loop_t {
+                std::unique_ptr<executable_t> code;
+                std::size_t close;
+        };
+
+        std::vector<unsigned int> back_edges_;
+        std::vector<loop_t> loops_;
+        int highest_;
+};
+
+template<typename C, typename S> inline void jit_tier_t<C, S>::reset(const bytecode_t& bytecode)
+{
+        int lowest;
+
+        back_edges_.assign(bytecode.code.size(), 0);
+        loops_.clear();
+        offset_range(bytecode, lowest, highest_);
+}
+
+template<typename C, typename S> inline int jit_tier_t<C, S>::promote(const bytecode_t& bytecode, std::size_t open, bool budgeted)
+{
+        assembler_t code;
+        loop_t loop;
+
+        loop.close = bytecode.code[open].operand;
+        jit_compile<C>(bytecode, code, true, open, loop.close + 1, budgeted);
+        loop.code.reset(new executable_t(code));
+
+        loops_.push_back(std::move(loop));
+        return static_cast<int>(loops_.size() - 1);
+}
+
+template<typename C, typename S> template<typename P, typename B>
+const char* jit_tier_t<C, S>::run(int loop, state_t<unsigned int, S, P>& state, io_t& io, B& budget, std::size_t& next)
+{
+        typedef int (*entry_t)(C* cell, jit_context_t* context);
+        typedef jit_state_tape_t<C, S, P> tape_t;
+
+        tape_t tape(state, highest_);
+        jit_context_t context;
+
+        context.grow   = &jit_grow<C, tape_t>;
+        context.scan   = &jit_scan<C, tape_t>;
+        context.output = &jit_output;
+        context.input  = &jit_input<C>;
+        context.io     = &io;
+        context.fault  = 0;
+        context.error  = 0;
+        context.cell   = 0;
+        tape.bind(context);
+        jit_bind_budget(context, budget);
+
+        entry_t entry = reinterpret_cast<entry_t>(const_cast<void*>(loops_[loop].code->entry()));
+        int status = entry(tape.base() + state.pc(), &context);
+
+        jit_unbind_budget(context, budget);
+
+        //! A loop stopped by the budget is left as it was, where the interpreter can
+        //  report on it.
+        if (status == 0 || (B::enabled && budget.reached()))
+                state.set_pc(static_cast<unsigned int>(static_cast<C*>(context.cell) - tape.base()));
+
+        if (status != 0) {
+                next = context.fault;
+                return context.error;
+        }
+
+        next = loops_[loop].close;
+
+        return 0;
+}
+
+//! Loops run natively on the interpreter's own cells, which have to be in one piece.
+template<typename C, typename S> struct tier_of<C, S, wrap_policy_t> {
+        typedef typename std::conditional<tape_contiguous<S>::value, jit_tier_t<C, S>, no_tier_t>::type type;
+};
+
+} // namespace detail
+
+#endif
+
+//! Evaluates the program with the threaded interpreter and compiles the loops that
+//  turn out to be hot to native code, so short runs don't wait for a compiler and
+//  long ones don't stay interpreted. Cells that don't wrap, and platforms without
+//  native code generation, leave it all to the interpreter. Native loops spend from
+//  the budget as the interpreter does.
+template<typename C, typename S, typename P, typename R, typename B>
+int evaluate_tiered(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder, B& budget)
+{
+        typename detail::tier_of<C, S, P>::type tier;
+
+        return evaluate_threaded<C, S, P>(program, program_size, ignore_unknowns, io, recorder, tier, budget);
+}
+
+template<typename C, typename S, typename P, typename R>
+int evaluate_tiered(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io, R& recorder)
+{
+        detail::no_budget_t budget;
+
+        return evaluate_tiered<C, S, P>(program, program_size, ignore_unknowns, io, recorder, budget);
+}
+
+template<typename C, typename S, typename P>
+int evaluate_tiered(const char* program, size_t program_size, bool ignore_unknowns, detail::io_t& io)
+{
+        detail::no_recorder_t recorder;
+
+        return evaluate_tiered<C, S, P>(program, program_size, ignore_unknowns, io, recorder);
+}
+
+template<typename C>
+int evaluate_tiered(const char* program, size_t program_size, bool ignore_unknowns = false)
+{
+        detail::io_t io;
+
+        return evaluate_tiered<C, std::vector<C>, detail::wrap_policy_t>(program, program_size, ignore_unknowns, io);
+}
+
+#endif /* _H_BF_TIERED */
\ No newline at end of file
@@ -17,13 +17,29 @@
 */
 
 #include "bf_evaluate.h"
+#include "bf_threaded.h"
+#include "bf_tiered.h"
+#include "bf_program.h"
+#include "bf_cache.h"
+#include "bf_jit.h"
+#include "bf_emit_c.h"
+#include "bf_guarded.h"
+#include "bf_paged.h"
+#include "bf_io.h"
+#include "bf_profile.h"
+#include "bf_stats.h"
 #include "bf_reader.h"
+#include "bf_batch.h"
+#include "bf_checkpoint.h"
 
 #include <cstdlib>
+#include <stdint.h>
 #include <getopt.h>
 #include <cstring>
 #include <stdexcept>
 #include <iostream>
+#include <thread>
+#include <memory>
 
 int usage()
 {
@@ -34,38 +50,543 @@ int usage()
         cout<<"  -e, --evaluate=program    evaluate a one line program"<<endl;
         cout<<"  -i, --ignore-unknowns     ignore unknown command within the program"<<endl;
         cout<<"  -s, --use-signed-cells    use a signed type for each cell"<<endl;
+        cout<<"      --engine=name         execution engine: tiered (default), threaded, jit, switch or lanes"<<endl;
+        cout<<"      --cell-bits=n         cell width: 8 (default), 16, 32 or 64"<<endl;
+        cout<<"      --overflow=name       at the cell limits: wrap (default), trap or saturate"<<endl;
+        cout<<"      --tape=name           cell storage: vector (default), guarded or paged"<<endl;
+        cout<<"      --flush=name          write output at: line, block or never (before input)"<<endl;
+        cout<<"      --eof=value           cell after reading past the input: 0, -1 (default) or unchanged"<<endl;
+        cout<<"      --profile             count what runs and report the hottest loops on stderr"<<endl;
+        cout<<"      --stats               report phase timings, counts and hardware counters on stderr"<<endl;
+        cout<<"      --emit-c              write the program out as C instead of evaluating it"<<endl;
+        cout<<"      --batch               run every job of the manifest given instead of a program"<<endl;
+        cout<<"      --jobs=n              threads --batch runs on (default: one per core)"<<endl;
+        cout<<"      --cache=dir           keep compiled programs in dir and reuse them"<<endl;
+        cout<<"      --cache-limit=n       megabytes the cache directory is kept under (default: 64)"<<endl;
+        cout<<"      --checkpoint=file     save the state to file on SIGTERM or SIGINT, then exit"<<endl;
+        cout<<"      --checkpoint-every=n  also save it every n seconds"<<endl;
+        cout<<"      --resume=file         carry on from a checkpoint, skipping the input it had read"<<endl;
+        cout<<"      --max-steps=n         stop after n loop iterations, exit with 124 and show the state"<<endl;
+        cout<<"      --timeout=seconds     stop after that long, the same way"<<endl;
         cout<<"  -h, --help                print this message"<<endl;
 
         return EXIT_SUCCESS;
 }
 
+enum engine_t {
+        ENGINE_Tiered
+      , ENGINE_Threaded
+      , ENGINE_Switch
+      , ENGINE_Jit
+      , ENGINE_Lanes
+};
+
+//! Long options without a short equivalent.
+enum long_option_t {
+        OPT_Engine = 256
+      , OPT_EmitC
+      , OPT_Tape
+      , OPT_CellBits
+      , OPT_Overflow
+      , OPT_Flush
+      , OPT_Eof
+      , OPT_Profile
+      , OPT_Stats
+      , OPT_Batch
+      , OPT_Jobs
+      , OPT_Cache
+      , OPT_CacheLimit
+      , OPT_Checkpoint
+      , OPT_CheckpointEvery
+      , OPT_Resume
+      , OPT_MaxSteps
+      , OPT_Timeout
+};
+
+enum tape_t {
+        TAPE_Vector
+      , TAPE_Guarded
+      , TAPE_Paged
+};
+
+enum overflow_t {
+        OVERFLOW_Wrap
+      , OVERFLOW_Trap
+      , OVERFLOW_Saturate
+};
+
 struct options_t {
-        options_t() : ignore_unknowns(false), inline_program(false), use_signed(false) {
+        options_t() : ignore_unknowns(false), inline_program(false), use_signed(false), emit_c(false), profile(false), stats(false), batch(false), recorder(0), program(0), cache(0), cache_limit(detail::cache_limit_bytes), checkpoint(0), checkpoint_every(0), resume(0), max_steps(0), timeout(0), engine(ENGINE_Tiered), tape(TAPE_Vector), cell_bits(8), overflow(OVERFLOW_Wrap)
+                    , flush(detail::io_t::default_flush()), eof(detail::EOF_MinusOne), jobs(default_jobs()) {
         }
 
         bool ignore_unknowns;        // ignore any unknown characters encountered
         bool inline_program;         // -e was speficied
         bool use_signed;             // use signed cells
+        bool emit_c;                 // translate to C rather than evaluate
+        bool profile;                // count executions and report them
+        bool stats;                  // time the phases and report them
+        bool batch;                  // the source file is a manifest of jobs
+        detail::stats_t* recorder;   // where the stats go, owned by resolve_options_and_evaluate
+        const char* program;         // the -e program
+        const char* cache;           // directory compiled programs are kept in, if any
+        std::size_t cache_limit;     // bytes it is kept under
+        const char* checkpoint;      // file the state is saved to, if any
+        unsigned int checkpoint_every; // seconds between saves, 0 for on a signal only
+        const char* resume;          // checkpoint to carry on from, if any
+        uint64_t max_steps;          // back-edges a run may take, 0 for no limit
+        double timeout;              // seconds it may take, 0 for no limit
+        engine_t engine;             // engine that evaluates the program
+        tape_t tape;                 // cell storage
+        int cell_bits;               // cell width
+        overflow_t overflow;         // what happens at the cell limits
+        detail::flush_t flush;       // when output is written out
+        detail::eof_t eof;           // what ',' stores at the end of input
+        unsigned int jobs;           // threads a batch runs on
+
+        static unsigned int default_jobs() {
+                unsigned int cores = std::thread::hardware_concurrency();
+                return cores ? cores : 1;
+        }
 };
 
-int resolve_options_and_evaluate(const options_t& options, int optind, int argc, char* argv[])
+bool parse_engine(const char* name, engine_t& engine)
 {
-        typedef signed   int S_storage;
-        typedef unsigned int U_storage;
+        if (!strcmp(name, "tiered"))
+                engine = ENGINE_Tiered;
+        else if (!strcmp(name, "threaded"))
+                engine = ENGINE_Threaded;
+        else if (!strcmp(name, "switch"))
+                engine = ENGINE_Switch;
+        else if (!strcmp(name, "jit"))
+                engine = ENGINE_Jit;
+        else if (!strcmp(name, "lanes"))
+                engine = ENGINE_Lanes;
+        else
+                return false;
 
-        if (options.inline_program && optind == argc) {
+        return true;
+}
+
+bool parse_tape(const char* name, tape_t& tape)
+{
+        if (!strcmp(name, "vector"))
+                tape = TAPE_Vector;
+        else if (!strcmp(name, "guarded"))
+                tape = TAPE_Guarded;
+        else if (!strcmp(name, "paged"))
+                tape = TAPE_Paged;
+        else
+                return false;
+
+        return true;
+}
+
+bool parse_cell_bits(const char* value, int& cell_bits)
+{
+        cell_bits = atoi(value);
+
+        return cell_bits == 8 || cell_bits == 16 || cell_bits == 32 || cell_bits == 64;
+}
+
+bool parse_overflow(const char* name, overflow_t& overflow)
+{
+        if (!strcmp(name, "wrap"))
+                overflow = OVERFLOW_Wrap;
+        else if (!strcmp(name, "trap"))
+                overflow = OVERFLOW_Trap;
+        else if (!strcmp(name, "saturate"))
+                overflow = OVERFLOW_Saturate;
+        else
+                return false;
+
+        return true;
+}
+
+bool parse_flush(const char* name, detail::flush_t& flush)
+{
+        if (!strcmp(name, "line"))
+                flush = detail::FLUSH_Line;
+        else if (!strcmp(name, "block"))
+                flush = detail::FLUSH_Block;
+        else if (!strcmp(name, "never"))
+                flush = detail::FLUSH_Never;
+        else
+                return false;
+
+        return true;
+}
+
+bool parse_jobs(const char* value, unsigned int& jobs)
+{
+        int count = atoi(value);
+
+        if (count < 1)
+                return false;
+
+        jobs = count;
+        return true;
+}
+
+bool parse_cache_limit(const char* value, std::size_t& limit)
+{
+        int megabytes = atoi(value);
+
+        if (megabytes < 1)
+                return false;
+
+        limit = std::size_t(megabytes) << 20;
+        return true;
+}
+
+bool parse_checkpoint_every(const char* value, unsigned int& seconds)
+{
+        int count = atoi(value);
+
+        if (count < 1)
+                return false;
+
+        seconds = count;
+        return true;
+}
+
+bool parse_max_steps(const char* value, uint64_t& steps)
+{
+        char* end;
+
+        steps = strtoull(value, &end, 10);
+
+        return *value && !*end && steps != 0;
+}
+
+bool parse_timeout(const char* value, double& seconds)
+{
+        char* end;
+
+        seconds = strtod(value, &end);
+
+        return *value && !*end && seconds > 0;
+}
+
+bool parse_eof(const char* value, detail::eof_t& eof)
+{
+        if (!strcmp(value, "0"))
+                eof = detail::EOF_Zero;
+        else if (!strcmp(value, "-1"))
+                eof = detail::EOF_MinusOne;
+        else if (!strcmp(value, "unchanged"))
+                eof = detail::EOF_Unchanged;
+        else
+                return false;
+
+        return true;
+}
+
+template<typename C, typename S, typename P, typename R, typename B>
+int evaluate_on(const options_t& options, const char* program, size_t program_size, detail::io_t& io, R& recorder, B& budget)
+{
+        detail::no_tier_t tier;
+
+        switch (options.engine) {
+        case ENGINE_Switch:
+                return evaluate<C, S, P>(program, program_size, options.ignore_unknowns, io, recorder, budget);
+        case ENGINE_Jit:
+                return evaluate_jit<C, S>(program, program_size, options.ignore_unknowns, io, recorder, budget);
+        case ENGINE_Tiered:
+                return evaluate_tiered<C, S, P>(program, program_size, options.ignore_unknowns, io, recorder, budget);
+        case ENGINE_Threaded:
+        case ENGINE_Lanes:
+                break;
+        }
+
+        return evaluate_threaded<C, S, P>(program, program_size, options.ignore_unknowns, io, recorder, tier, budget);
+}
+
+template<typename C, typename S, typename P, typename R>
+int evaluate_on(const options_t& options, const char* program, size_t program_size, detail::io_t& io, R& recorder)
+{
+        detail::no_budget_t budget;
+
+        return evaluate_on<C, S, P>(options, program, program_size, io, recorder, budget);
+}
+
+//! Compiles the program, or reads it back from the cache.
+template<typename C, typename P>
+bf::program_t<C, P> compile_program(const options_t& options, const char* program, size_t program_size)
+{
+        if (options.cache)
+                return bf::cache_t(options.cache, options.cache_limit).load<C, P>(program, program_size, options.ignore_unknowns);
+
+        return bf::program_t<C, P>(program, program_size, options.ignore_unknowns);
+}
+
+//! The plain case - no recorder, interpreted - goes through the library.
+template<typename C, typename S, typename P>
+int run_program(const options_t& options, const char* program, size_t program_size)
+{
+        try {
+                bf::program_t<C, P> compiled = compile_program<C, P>(options, program, program_size);
+                bf::execution_t<C, S, P> execution(options.flush, options.eof, options.engine == ENGINE_Tiered);
+
+                execution.run(compiled);
+        }
+        catch (bf::error_t& e) {
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+
+        return EXIT_SUCCESS;
+}
+
+//! As run_program, for native code - which only wraps.
+template<typename C, typename S>
+int run_jit_program(const options_t& options, const char* program, size_t program_size)
+{
+        detail::io_t io(STDIN_FILENO, STDOUT_FILENO, options.flush, options.eof);
+        detail::no_recorder_t recorder;
+
+        try {
+                bf::program_t<C, detail::wrap_policy_t> compiled = compile_program<C, detail::wrap_policy_t>(options, program, program_size);
+
+                return detail::run_jit<C, S>(program, program_size, compiled.bytecode(), compiled.prefix(), io, recorder);
+        }
+        catch (bf::error_t& e) {
+                return detail::display_error_cause(e.what(), program, program_size, e.commands);
+        }
+}
+
+template<typename C, typename S, typename P>
+int evaluate_on(const options_t& options, const char* program, size_t program_size)
+{
+        if ((options.engine == ENGINE_Tiered || options.engine == ENGINE_Threaded) && !options.profile && !options.stats)
+                return run_program<C, S, P>(options, program, program_size);
+
+        if (options.engine == ENGINE_Jit && !options.profile && !options.stats)
+                return run_jit_program<C, S>(options, program, program_size);
+
+        detail::io_t io(STDIN_FILENO, STDOUT_FILENO, options.flush, options.eof);
+
+        if (options.profile) {
+                detail::profile_t profile(program_size);
+                int status = evaluate_on<C, S, P>(options, program, program_size, io, profile);
+
+                io.flush_quietly();
+                profile.report(std::cerr, program, program_size);
+                return status;
+        }
+
+        if (options.stats) {
+                int status = evaluate_on<C, S, P>(options, program, program_size, io, *options.recorder);
+
+                io.flush_quietly();
+                options.recorder->report(std::cerr, options.engine != ENGINE_Jit);
+                return status;
+        }
+
+        detail::no_recorder_t recorder;
+
+        return evaluate_on<C, S, P>(options, program, program_size, io, recorder);
+}
+
+template<typename C, typename S>
+int evaluate_with_policy(const options_t& options, const char* program, size_t program_size)
+{
+        switch (options.overflow) {
+        case OVERFLOW_Trap:
+                return evaluate_on<C, S, detail::trap_policy_t>(options, program, program_size);
+        case OVERFLOW_Saturate:
+                return evaluate_on<C, S, detail::saturate_policy_t>(options, program, program_size);
+        case OVERFLOW_Wrap:
+                break;
+        }
+
+        return evaluate_on<C, S, detail::wrap_policy_t>(options, program, program_size);
+}
+
+template<typename C, typename S>
+int evaluate_batch_with(const options_t& options, const char* manifest, size_t manifest_size)
+{
+        std::unique_ptr<bf::cache_t> cache(options.cache ? new bf::cache_t(options.cache, options.cache_limit) : 0);
+        detail::batch_engine_t engine = detail::BATCH_Tiered;
+        detail::batch_limits_t limits(options.max_steps, options.timeout);
+
+        if (options.engine == ENGINE_Threaded)
+                engine = detail::BATCH_Threaded;
+        else if (options.engine == ENGINE_Lanes)
+                engine = detail::BATCH_Lanes;
+
+        switch (options.overflow) {
+        case OVERFLOW_Trap:
+                return evaluate_batch<C, S, detail::trap_policy_t>(manifest, manifest_size, options.ignore_unknowns, options.eof, options.jobs, engine, cache.get(), limits);
+        case OVERFLOW_Saturate:
+                return evaluate_batch<C, S, detail::saturate_policy_t>(manifest, manifest_size, options.ignore_unknowns, options.eof, options.jobs, engine, cache.get(), limits);
+        case OVERFLOW_Wrap:
+                break;
+        }
+
+        return evaluate_batch<C, S, detail::wrap_policy_t>(manifest, manifest_size, options.ignore_unknowns, options.eof, options.jobs, engine, cache.get(), limits);
+}
+
+//! Runs with limits, on the vector or paged tape.
+template<typename C, typename S>
+int evaluate_budgeted_with(const options_t& options, const char* program, size_t program_size)
+{
+        detail::io_t io(STDIN_FILENO, STDOUT_FILENO, options.flush, options.eof);
+        detail::no_recorder_t recorder;
+        detail::budget_t budget(options.max_steps, options.timeout);
+
+        switch (options.overflow) {
+        case OVERFLOW_Trap:
+                return evaluate_on<C, S, detail::trap_policy_t>(options, program, program_size, io, recorder, budget);
+        case OVERFLOW_Saturate:
+                return evaluate_on<C, S, detail::saturate_policy_t>(options, program, program_size, io, recorder, budget);
+        case OVERFLOW_Wrap:
+                break;
+        }
+
+        return evaluate_on<C, S, detail::wrap_policy_t>(options, program, program_size, io, recorder, budget);
+}
+
+template<typename C>
+int evaluate_checkpointed_with(const options_t& options, const char* program, size_t program_size)
+{
+        std::string checkpoint(options.checkpoint ? options.checkpoint : "");
+        std::string resume(options.resume ? options.resume : "");
+
+        switch (options.overflow) {
+        case OVERFLOW_Trap:
+                return evaluate_checkpointed<C, detail::trap_policy_t>(program, program_size, options.ignore_unknowns, options.flush, options.eof, checkpoint, options.checkpoint_every, resume);
+        case OVERFLOW_Saturate:
+                return evaluate_checkpointed<C, detail::saturate_policy_t>(program, program_size, options.ignore_unknowns, options.flush, options.eof, checkpoint, options.checkpoint_every, resume);
+        case OVERFLOW_Wrap:
+                break;
+        }
+
+        return evaluate_checkpointed<C, detail::wrap_policy_t>(program, program_size, options.ignore_unknowns, options.flush, options.eof, checkpoint, options.checkpoint_every, resume);
+}
+
+template<typename C>
+int evaluate_with(const options_t& options, const char* program, size_t program_size)
+{
+        if (options.batch && ((options.engine != ENGINE_Tiered && options.engine != ENGINE_Threaded && options.engine != ENGINE_Lanes) ||
+                              options.tape == TAPE_Guarded || options.emit_c || options.profile || options.stats)) {
+                std::cout<<"--batch runs on --engine=tiered, threaded or lanes and --tape=vector or paged only"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if (options.engine == ENGINE_Lanes && (!options.batch || options.overflow != OVERFLOW_Wrap)) {
+                std::cout<<"--engine=lanes runs --batch jobs with --overflow=wrap only"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if ((options.max_steps || options.timeout) && (options.engine == ENGINE_Lanes || options.tape == TAPE_Guarded ||
+                                                       options.emit_c || options.profile || options.stats || options.checkpoint || options.resume)) {
+                std::cout<<"--max-steps and --timeout run on --tape=vector or paged only, without --engine=lanes, --emit-c, --profile, --stats or checkpoints"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if (options.checkpoint_every && !options.checkpoint) {
+                std::cout<<"--checkpoint-every needs --checkpoint"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if ((options.checkpoint || options.resume) && (options.engine != ENGINE_Threaded || options.tape != TAPE_Vector ||
+                                                       options.batch || options.emit_c || options.profile || options.stats)) {
+                std::cout<<"--checkpoint and --resume run on --engine=threaded and --tape=vector only"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if (options.checkpoint || options.resume)
+                return evaluate_checkpointed_with<C>(options, program, program_size);
+
+        if (options.batch && options.tape == TAPE_Paged)
+                return evaluate_batch_with<C, detail::paged_storage_t<C> >(options, program, program_size);
+
+        if (options.batch)
+                return evaluate_batch_with<C, std::vector<C> >(options, program, program_size);
+
+        if ((options.emit_c || options.engine == ENGINE_Jit) && options.overflow != OVERFLOW_Wrap) {
+                std::cout<<"Native code only supports --overflow=wrap"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if (options.profile && (options.emit_c || options.engine == ENGINE_Jit)) {
+                std::cout<<"Profiling needs --engine=threaded or --engine=switch"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if (options.profile && options.stats) {
+                std::cout<<"--profile and --stats can't be combined"<<std::endl;
+                return EXIT_FAILURE;
+        }
+
+        if ((options.max_steps || options.timeout) && options.tape == TAPE_Paged)
+                return evaluate_budgeted_with<C, detail::paged_storage_t<C> >(options, program, program_size);
+
+        if (options.max_steps || options.timeout)
+                return evaluate_budgeted_with<C, std::vector<C> >(options, program, program_size);
+
+        if (options.emit_c)
+                return translate_to_c<C>(program, program_size, options.ignore_unknowns, std::cout, options.flush, options.eof);
+
+        if (options.tape == TAPE_Guarded)
+                return evaluate_with_policy<C, detail::guarded_storage_t<C> >(options, program, program_size);
+
+        if (options.tape == TAPE_Paged)
+                return evaluate_with_policy<C, detail::paged_storage_t<C> >(options, program, program_size);
+
+        return evaluate_with_policy<C, std::vector<C> >(options, program, program_size);
+}
+
+//! Picks the cell type, every width is instantiated signed and unsigned.
+int evaluate_program(const options_t& options, const char* program, size_t program_size)
+{
+        switch (options.cell_bits) {
+        case 16:
                 return options.use_signed ?
-                        evaluate<S_storage>(argv[optind - 1], strlen(argv[optind - 1]), options.ignore_unknowns) :
-                        evaluate<U_storage>(argv[optind - 1], strlen(argv[optind - 1]), options.ignore_unknowns);
+                        evaluate_with<int16_t>(options, program, program_size) :
+                        evaluate_with<uint16_t>(options, program, program_size);
+        case 32:
+                return options.use_signed ?
+                        evaluate_with<int32_t>(options, program, program_size) :
+                        evaluate_with<uint32_t>(options, program, program_size);
+        case 64:
+                return options.use_signed ?
+                        evaluate_with<int64_t>(options, program, program_size) :
+                        evaluate_with<uint64_t>(options, program, program_size);
+        }
+
+        return options.use_signed ?
+                evaluate_with<int8_t>(options, program, program_size) :
+                evaluate_with<uint8_t>(options, program, program_size);
+}
+
+int resolve_options_and_evaluate(const options_t& given, int optind, int argc, char* argv[])
+{
+        detail::stats_t stats;
+        options_t options(given);
+
+        options.recorder = &stats;
+
+        //! Profiling counts every instruction, none of them may run natively. Neither
+        //  may those --stats counts.
+        if ((options.profile || options.stats) && options.engine == ENGINE_Tiered)
+                options.engine = ENGINE_Threaded;
+
+        //! Nor may those of a checkpointed run - native code has no back-edges to stop at.
+        if ((options.checkpoint || options.resume) && options.engine == ENGINE_Tiered)
+                options.engine = ENGINE_Threaded;
+
+        if (options.inline_program && optind == argc) {
+                stats.loaded();
+                return evaluate_program(options, options.program, strlen(options.program));
         }
 
         if (!options.inline_program && optind < argc) {
                 try {
                         detail::reader_t program(argv[optind]);
 
-                        return options.use_signed ?
-                                evaluate<S_storage>(program.raw(), program.size(), options.ignore_unknowns) :
-                                evaluate<U_storage>(program.raw(), program.size(), options.ignore_unknowns);
+                        stats.loaded();
+                        return evaluate_program(options, program.raw(), program.size());
                 }
                 catch (std::runtime_error& e) {
                         std::cout<<e.what()<<std::endl;
@@ -84,6 +605,25 @@ int main(int argc, char* argv[])
               , { "use-signed-cells", no_argument,       0, 's' }
               , { "ignore-unknowns",  no_argument,       0, 'i' }
               , { "help",             no_argument,       0, 'h' }
+              , { "engine",           required_argument, 0, OPT_Engine }
+              , { "emit-c",           no_argument,       0, OPT_EmitC }
+              , { "tape",             required_argument, 0, OPT_Tape }
+              , { "cell-bits",        required_argument, 0, OPT_CellBits }
+              , { "overflow",         required_argument, 0, OPT_Overflow }
+              , { "flush",            required_argument, 0, OPT_Flush }
+              , { "eof",              required_argument, 0, OPT_Eof }
+              , { "profile",          no_argument,       0, OPT_Profile }
+              , { "stats",            no_argument,       0, OPT_Stats }
+              , { "batch",            no_argument,       0, OPT_Batch }
+              , { "jobs",             required_argument, 0, OPT_Jobs }
+              , { "cache",            required_argument, 0, OPT_Cache }
+              , { "cache-limit",      required_argument, 0, OPT_CacheLimit }
+              , { "checkpoint",       required_argument, 0, OPT_Checkpoint }
+              , { "checkpoint-every", required_argument, 0, OPT_CheckpointEvery }
+              , { "resume",           required_argument, 0, OPT_Resume }
+              , { "max-steps",        required_argument, 0, OPT_MaxSteps }
+              , { "timeout",          required_argument, 0, OPT_Timeout }
+              , { 0,                  0,                 0, 0 }
         };
 
         options_t options;
@@ -98,10 +638,98 @@ int main(int argc, char* argv[])
                         break;
                 case 'e':
                         options.inline_program = true;
+                        options.program = optarg;
                         break;
                 case 's':
                         options.use_signed = true;
                         break;
+                case OPT_Engine:
+                        if (!parse_engine(optarg, options.engine)) {
+                                std::cout<<"Unknown engine: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Tape:
+                        if (!parse_tape(optarg, options.tape)) {
+                                std::cout<<"Unknown tape: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_CellBits:
+                        if (!parse_cell_bits(optarg, options.cell_bits)) {
+                                std::cout<<"Unsupported cell width: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Overflow:
+                        if (!parse_overflow(optarg, options.overflow)) {
+                                std::cout<<"Unknown overflow policy: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Flush:
+                        if (!parse_flush(optarg, options.flush)) {
+                                std::cout<<"Unknown flush mode: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Eof:
+                        if (!parse_eof(optarg, options.eof)) {
+                                std::cout<<"Unknown end of input value: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Profile:
+                        options.profile = true;
+                        break;
+                case OPT_Stats:
+                        options.stats = true;
+                        break;
+                case OPT_EmitC:
+                        options.emit_c = true;
+                        break;
+                case OPT_Batch:
+                        options.batch = true;
+                        break;
+                case OPT_Jobs:
+                        if (!parse_jobs(optarg, options.jobs)) {
+                                std::cout<<"Invalid number of jobs: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Cache:
+                        options.cache = optarg;
+                        break;
+                case OPT_CacheLimit:
+                        if (!parse_cache_limit(optarg, options.cache_limit)) {
+                                std::cout<<"Invalid cache limit: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Checkpoint:
+                        options.checkpoint = optarg;
+                        break;
+                case OPT_CheckpointEvery:
+                        if (!parse_checkpoint_every(optarg, options.checkpoint_every)) {
+                                std::cout<<"Invalid checkpoint interval: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Resume:
+                        options.resume = optarg;
+                        break;
+                case OPT_MaxSteps:
+                        if (!parse_max_steps(optarg, options.max_steps)) {
+                                std::cout<<"Invalid number of steps: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
+                case OPT_Timeout:
+                        if (!parse_timeout(optarg, options.timeout)) {
+                                std::cout<<"Invalid timeout: "<<optarg<<std::endl;
+                                return EXIT_FAILURE;
+                        }
+                        break;
                 case 'h':
                 case '?':
                         return usage();